@@ -46,12 +46,41 @@
  *     (r+1,c+1) == X && (r+2,c+2) == O ==> (r,c) := O, (r+1,c+1) := O, (r+2,c+2) := X
  *     (r,c-2)   == X && (r,c-2)   == O ==> (r,c) := O, (r,c-2)   := O, (r,c-4)   := X
  *     (r,c+2)   == X && (r,c+2)   == O ==> (r,c) := O, (r,c+2)   := O, (r,c+4)   := X
+ *
+ * Larger triangles don't fit the fixed grid above, so there is also a
+ * bitboard engine (-b, or any -s other than 5).  A triangle of side S has
+ * S * (S + 1) / 2 holes, numbered 1.. in reading order; hole (r,c), with
+ * 0 <= c <= r < S, lives at bit r * S + c.  With that padding every one of
+ * the six jump directions is a constant shift (1, S or S + 1 either way)
+ * and no single step can wrap from one valid hole onto another, so all the
+ * jumps in one direction are found at once with two shifts and two ANDs.
+ * The engine is stamped out for 64, 128 and 256 bit words and picked by
+ * board size at run time.
  */
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#include <time.h>
+#include <stdint.h>
+#include <unistd.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/resource.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#include "winnable15.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #undef DEBUG
 
@@ -70,9 +99,71 @@
 
 #define NUM_OFFSETS 6
 
+#define MAX_SIDE    16
+#define MAX_HOLES   (MAX_SIDE * (MAX_SIDE + 1) / 2)
+#define MAX_BITS    (MAX_SIDE * MAX_SIDE)
+#define MAX_MOVES   (3 * (MAX_SIDE - 1) * (MAX_SIDE - 2))
+#define MAX_DEPTH   (MAX_HOLES - 1)
+
+#define DEFAULT_SIDE    5
+#define DEFAULT_HOLE    5
+#define DEFAULT_BUDGET  256         /* megabytes */
+#define DEFAULT_HASH    64          /* megabytes */
+
+#define MAX_THREADS     256
+#define TT_PROBES       4
+#define TASKS_PER_THREAD 16
+
+#define BATCH_BLOCK     65536       /* positions read and solved at a time */
+#define BATCH_LINE_LEN  1024
+
+#define NUM_COUNTERS    4
+#define DEADLINE_CHECK  4096        /* nodes between looks at the clock; a power of 2 */
+#define PROGRESS_LEVELS 16          /* of the tree, for estimating how much is done */
+
+#define MEM_NODES       0           /* what memory is for */
+#define MEM_CACHE       1
+#define MEM_FRONTIER    2
+#define MEM_SOLUTIONS   3
+#define NUM_MEM         4
+#define MIN_HASH_ENTRIES 1024
+#define MIN_HASH_FRACTION 16        /* smallest cut of the -H table worth searching with */
+
+#define SINK_SIZE       65536
+#define RECORD_SIZE     40          /* bytes in a binary output record */
+#define RECORD_MOVES    16          /* moves in a binary moves record */
+
+#define MERGE_FANIN     64
+#define SPILL_NAME_LEN  1024
+
+#define MAX_RANK_HOLES  64          /* C(64, 32) still fits in 64 bits */
+
+#define NUM_SYMMETRIES  6
+#define SYM_CHUNKS      8           /* bytes in a 64-bit bitboard */
+
+#define MAX_PAGODAS         256
+#define PAGODA_MAX_SIZE     10
+#define PAGODAS_PER_TARGET  8
+
 #define FALSE 0
 #define TRUE  1
 
+#define OUTPUT_TEXT     0
+#define OUTPUT_JSON     1
+#define OUTPUT_BINARY   2
+
+#define RECORD_RESULT   1
+#define RECORD_MOVES_OF 2
+
+#define RECORD_INVALID  1           /* flags */
+#define RECORD_DISTINCT 2
+#define RECORD_LAST     4
+#define RECORD_STOPPED  8
+
+#define GRAPH_DOT       1           /* -X formats */
+#define GRAPH_CSR       2
+#define GRAPH_WON       1           /* node flag: the position can be won */
+
 #define CLEAR_SCREEN    printf("\033[2J")
 #define CURSOR_HOME     printf("\033[H")
 #define INVERSE_VIDEO   printf("\033[7m")
@@ -86,27 +177,211 @@ struct board {
     int squares[NUM_ROWS][NUM_COLS];
     struct board *next[MAX_BOARDS];
     struct board *prev;
-    struct board *nextwin;
     int boardnum;
+    uint64_t hash;
+};
+
+/*
+ * A jump, by hole number (0-based).  Moves are numbered in the order
+ * generate_boards() would find them: by from hole, then by offset.
+ */
+struct move {
+    int from;
+    int over;
+    int to;
+};
+
+/* A move number; there are fewer than 65536 moves on any board we handle */
+typedef unsigned short move_index;
+
+struct geometry {
+    int side;
+    int holes;
+    int nmoves;
+    int row[MAX_HOLES];
+    int col[MAX_HOLES];
+    int bit[MAX_HOLES];
+    int hole_at[MAX_BITS];                  /* -1 if not a hole */
+    int step[NUM_OFFSETS];                  /* bit distance of one step */
+    struct move moves[MAX_MOVES];
+    short move_at[MAX_BITS][NUM_OFFSETS];   /* by destination bit */
+    int mobility[MAX_HOLES];                /* moves from or over each hole */
 };
 
 int rowoffsets[NUM_OFFSETS] = {-1, -1,  1, 1,  0, 0};
 int coloffsets[NUM_OFFSETS] = {-1,  1, -1, 1, -2, 2};
 
-int total_boards = 1;
-int total_winning_boards = 0;
+/* The same six directions as (row, position in row) on the triangle */
+int trirowoffsets[NUM_OFFSETS] = {-1, -1, 1, 1,  0, 0};
+int tricoloffsets[NUM_OFFSETS] = {-1,  0, 0, 1, -1, 1};
+
+/*
+ * A pagoda function with weights of 0 or 1: a set of holes that no peg
+ * can jump into unless it starts in the set or jumps over a peg in it.
+ * Once a position has no pegs in such a set, it never will again, so the
+ * last peg can't finish anywhere in it.
+ */
+struct pagoda {
+    int nholes;
+    int holes[PAGODA_MAX_SIZE];
+};
+
+/* Per-thread tallies for random playouts */
+struct playout_worker {
+    pthread_t thread;
+    uint64_t rng;
+    long long games;
+    long long wins;
+    long long pegs_left[MAX_HOLES + 1];
+};
+
+/*
+ * Machine-readable output goes through a buffer of our own, so a big batch
+ * run makes one write per SINK_SIZE bytes rather than a call per result.
+ */
+struct sink {
+    FILE *fp;
+    size_t len;
+    char buf[SINK_SIZE];
+};
+
+struct sink out;
+
+/*
+ * Bytes allocated by the search, by what they're for, now and at most,
+ * checked against the -L limit.  Only the main thread allocates.
+ */
+const char *mem_names[NUM_MEM] = { "nodes", "cache", "frontier", "lines" };
+long long mem_now[NUM_MEM];
+long long mem_peak[NUM_MEM];
+long long mem_total = 0;
+long long mem_total_peak = 0;
+
+/*
+ * Hardware counters for -p, opened once and read at the end of each phase.
+ * Any that can't be opened (not Linux, no PMU, or perf_event_paranoid)
+ * stay at -1 and only the times are shown.
+ */
+const char *counter_names[NUM_COUNTERS] = { "cycles", "instructions", "cache-misses", "branch-misses" };
+int counter_fd[NUM_COUNTERS] = { -1, -1, -1, -1 };
+uint64_t counter_last[NUM_COUNTERS];
+double profile_last;
+struct geometry geom;
+int grid_hole[NUM_ROWS][NUM_COLS];
+uint64_t zobrist[MAX_HOLES];
+
+/*
+ * The six symmetries of the triangle, as where each hole goes, and for
+ * boards that fit in 64 bits, the images of each byte of a bitboard under
+ * all six at once.
+ */
+int sym_perm[NUM_SYMMETRIES][MAX_HOLES];
+uint64_t sym_table[SYM_CHUNKS][256][NUM_SYMMETRIES];
+int sym_chunks = 0;
+
+struct pagoda pagodas[MAX_PAGODAS];
+int npagodas = 0;
+unsigned char pagoda_target[MAX_HOLES];     /* where the last peg could finish */
+long long pagoda_cuts = 0;
+
+long long total_boards = 1;
+long long total_winning_boards = 0;
+long long distinct_boards = 0;
 int depth = 0;
-struct board *winning_board = NULL;
+
+/* The moves leading to the position being searched */
+int bb_path[MAX_DEPTH];
+
+/*
+ * The line leaving fewest pegs found so far, the answer if the search is
+ * stopped before it finds a win.
+ */
+int best_pegs = MAX_HOLES + 1;
+move_index best_path[MAX_DEPTH];
+
+/*
+ * Set when the -t deadline passes or on an interrupt; searches look at it
+ * every node and at the clock every DEADLINE_CHECK nodes, and unwind.
+ */
+atomic_int stopped;
+double deadline = 0;
+
+/*
+ * What a search thread shows the progress reporter.  Each thread has its
+ * own and brings it up to date every DEADLINE_CHECK nodes, when it looks
+ * at the clock anyway, with relaxed stores to memory no other thread
+ * writes, so the hot loop gains no shared writes.  The peg count it is at
+ * then is a sample; over many samples they show where the search spends
+ * its time.  done is the estimated fraction of the tree searched, from
+ * fraction() if the engine has one, or -1.
+ */
+struct progress {
+    long long ticks;                        /* nodes, private to the thread */
+    _Atomic long long nodes;
+    _Atomic long long samples[MAX_HOLES + 1];
+    _Atomic double done;
+    double (*fraction)(void);
+};
+
+struct progress main_progress;
+
+/* When the search started, and when and how far in it found its first win */
+double search_start = 0;
+double first_time = -1;
+long long first_boards = 0;
+
+/*
+ * Winning lines, as move numbers.  Every win takes one move fewer than
+ * there are pegs, so each line is geom.holes - 2 moves and they are packed
+ * one after another.  Up to max_solutions are kept.
+ */
+move_index *solutions = NULL;
+long long nsolutions = 0;
+long long solutions_size = 0;
+long long max_solutions = 1;
 
 int debug = 0;
 int visual = 0;
+int bitboard = 0;
+int inplace = 0;
+int low_memory = 0;
+double time_limit = 0;                      /* seconds, or 0 for none */
+int first_only = 0;
+int play = 0;
+int write_table = 0;
+int side = DEFAULT_SIDE;
+int start_hole = DEFAULT_HOLE;
+int pagoda = 0;
+int threads = 0;
+int check = 0;
+long long playouts = 0;
+int symmetry = 0;
+int output_format = OUTPUT_TEXT;
+int profiling = 0;
+int batch = 0;
+long long benchmark = 0;
+long long hash_size = (long long)DEFAULT_HASH << 20;
+int goal_hole = 0;                          /* 1-based, or 0 for anywhere */
+int external = 0;
+int dense = 0;
+int retro = 0;
+int checkpointing = 0;
+int resume = 0;
+int graph_format = 0;
+int outcomes = 0;
+long long memory_budget = (long long)DEFAULT_BUDGET << 20;
+long long memory_limit = 0;                 /* bytes, or 0 for no limit */
+char *spill_dir = ".";
 
 int generate_boards(struct board *b);
+void inplace_boards(struct board *b, int count, uint64_t pegs);
+int pagoda_dead(uint64_t pegs);
 
 void
 usage(char *name)
 {
-    fprintf(stderr, "usage: %s [-d] [-v]\n", name);
+    fprintf(stderr, "usage: %s [-d] [-v] [-W] [-a] [-b] [-c] [-r] [-f] [-i] [-I] [-l] [-p] [-x] [-D] [-R] [-P] [-y] [-C] [-B positions] [-k lines] [-o text|json|binary] [-X dot|csr] [-M games] [-j threads] [-H megabytes] [-s side] [-e hole] [-g hole]\n"
+            "       [-m megabytes] [-L megabytes] [-t seconds] [-u seconds] [-T dir]\n", name);
 }
 
 void
@@ -147,129 +422,5285 @@ print_board(struct board *b)
 }
 
 int
-count_pegs(struct board *b)
+mem_fits(long long bytes)
 {
-    int row;
-    int col;
-    int count = 0;
+    return memory_limit == 0 || mem_total + bytes <= memory_limit;
+}
 
-    for (row = 0; row < NUM_ROWS; row++) {
-        for (col = 0; col < NUM_COLS; col++) {
-            if (b->squares[row][col] & POS_FULL) {
-                count++;
+/* Count bytes allocated (or freed, if negative) */
+void
+mem_add(int what, long long bytes)
+{
+    mem_now[what] += bytes;
+    mem_total += bytes;
+    if (mem_now[what] > mem_peak[what]) {
+        mem_peak[what] = mem_now[what];
+    }
+    if (mem_total > mem_total_peak) {
+        mem_total_peak = mem_total;
+    }
+}
+
+/* For memory there's no doing without: stop cleanly rather than go over the limit */
+void
+mem_need(int what, long long bytes)
+{
+    if (!mem_fits(bytes)) {
+        fprintf(stderr, "memory limit of %lld MB reached: %.1f MB in use, %.1f MB more needed for the %s\n",
+                memory_limit >> 20, mem_total / 1048576.0, bytes / 1048576.0, mem_names[what]);
+        exit(2);
+    }
+    mem_add(what, bytes);
+}
+
+/* Peak resident set size in bytes, from the kernel */
+long long
+peak_rss(void)
+{
+    struct rusage ru;
+
+    if (getrusage(RUSAGE_SELF, &ru) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return ru.ru_maxrss;
+#else
+    return (long long)ru.ru_maxrss << 10;
+#endif
+}
+
+void
+print_memory(void)
+{
+    int i;
+
+    printf("Memory: %.1f MB peak tracked (", mem_total_peak / 1048576.0);
+    for (i = 0; i < NUM_MEM; i++) {
+        printf("%s%s %.1f", i > 0 ? ", " : "", mem_names[i], mem_peak[i] / 1048576.0);
+    }
+    printf("), %.1f MB peak RSS\n", peak_rss() / 1048576.0);
+}
+
+void
+sink_flush(struct sink *s)
+{
+    if (s->len > 0) {
+        fwrite(s->buf, 1, s->len, s->fp);
+        s->len = 0;
+    }
+    fflush(s->fp);
+}
+
+void
+sink_write(struct sink *s, const void *data, size_t n)
+{
+    if (s->len + n > SINK_SIZE) {
+        sink_flush(s);
+    }
+    if (n > SINK_SIZE) {
+        fwrite(data, 1, n, s->fp);
+        return;
+    }
+    memcpy(s->buf + s->len, data, n);
+    s->len += n;
+}
+
+void
+sink_printf(struct sink *s, const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(s->buf + s->len, SINK_SIZE - s->len, fmt, ap);
+    va_end(ap);
+    if (n >= 0 && (size_t)n < SINK_SIZE - s->len) {
+        s->len += n;
+        return;
+    }
+
+    /* It didn't fit; make room and try again */
+    sink_flush(s);
+    va_start(ap, fmt);
+    n = vsnprintf(s->buf, SINK_SIZE, fmt, ap);
+    va_end(ap);
+    s->len = (n < 0 ? 0 : n < SINK_SIZE ? n : SINK_SIZE - 1);
+}
+
+/*
+ * The binary format is a sequence of RECORD_SIZE-byte records, with every
+ * number little-endian:
+ *
+ *   0      type: RECORD_RESULT or RECORD_MOVES_OF
+ *   1      side
+ *   2      result: starting hole, 1-based, or 0 for a position read with -I
+ *   3      flags: RECORD_INVALID, RECORD_DISTINCT (boards counts distinct
+ *          positions), RECORD_STOPPED (the -t deadline passed, so the counts
+ *          are partial) or RECORD_LAST (the last moves of a line)
+ *   4-7    result: number of lines following; moves: moves in this record
+ *   8-39   result: position (holes as bits, hole 1 lowest, or 0 if the
+ *          board has more than 64 holes), boards, winning boards and
+ *          nanoseconds taken, 8 bytes each; moves: up to RECORD_MOVES
+ *          (from, to) pairs of 1-based holes, a byte each
+ *
+ * A winning line is as many moves records as it needs, the last flagged.
+ */
+static void
+put_le(unsigned char *p, uint64_t v, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        p[i] = v >> (8 * i);
+    }
+}
+
+void
+output_result(int start, uint64_t position, long long boards, long long winning, double seconds, int flags,
+              long long lines)
+{
+    unsigned char rec[RECORD_SIZE];
+
+    if (output_format == OUTPUT_JSON) {
+        if (flags & RECORD_INVALID) {
+            sink_printf(&out, "{\"type\":\"position\",\"error\":\"invalid\"}\n");
+            return;
+        }
+        if (start > 0) {
+            sink_printf(&out, "{\"type\":\"result\",\"side\":%d,\"start\":%d,", geom.side, start);
+        } else {
+            sink_printf(&out, "{\"type\":\"position\",\"side\":%d,\"position\":\"0x%llx\",", geom.side,
+                        (unsigned long long)position);
+        }
+        sink_printf(&out, "\"%s\":%lld,\"winning\":%lld", (flags & RECORD_DISTINCT) ? "distinct" : "boards",
+                    boards, winning);
+        if (seconds >= 0) {
+            sink_printf(&out, ",\"seconds\":%.6f", seconds);
+        }
+        if (flags & RECORD_STOPPED) {
+            sink_printf(&out, ",\"stopped\":true");
+            if (start > 0 && best_pegs <= geom.holes) {
+                int i;
+
+                sink_printf(&out, ",\"best_pegs\":%d,\"best_line\":[", best_pegs);
+                for (i = 0; i < geom.holes - 1 - best_pegs; i++) {
+                    sink_printf(&out, "%s[%d,%d]", i > 0 ? "," : "", geom.moves[best_path[i]].from + 1,
+                                geom.moves[best_path[i]].to + 1);
+                }
+                sink_printf(&out, "]");
             }
         }
+        if (start > 0 && first_only && first_time >= 0) {
+            sink_printf(&out, ",\"first_seconds\":%.6f,\"first_boards\":%lld", first_time, first_boards);
+        }
+        if (start > 0) {
+            sink_printf(&out, ",\"peak_bytes\":%lld,\"peak_rss\":%lld", mem_total_peak, peak_rss());
+        }
+        if (lines == 0) {
+            sink_printf(&out, "}\n");
+        }
+        return;
     }
 
-    return count;
+    memset(rec, 0, sizeof(rec));
+    rec[0] = RECORD_RESULT;
+    rec[1] = geom.side;
+    rec[2] = start;
+    rec[3] = flags;
+    put_le(rec + 4, lines, 4);
+    put_le(rec + 8, position, 8);
+    put_le(rec + 16, boards, 8);
+    put_le(rec + 24, winning, 8);
+    put_le(rec + 32, seconds > 0 ? (uint64_t)(seconds * 1e9) : 0, 8);
+    sink_write(&out, rec, sizeof(rec));
 }
 
+/*
+ * One of the winning lines announced by output_result(), as JSON arrays of
+ * [from, to] holes (numbered from 1) or binary moves records.
+ */
 void
-clear_last(struct board *b)
+output_line(const move_index *line, int first, int last)
+{
+    unsigned char rec[RECORD_SIZE];
+    int nmoves = geom.holes - 2;
+    int i;
+    int j;
+
+    if (output_format == OUTPUT_JSON) {
+        sink_printf(&out, "%s[", first ? ",\"solutions\":[" : ",");
+        for (i = 0; i < nmoves; i++) {
+            sink_printf(&out, "%s[%d,%d]", i > 0 ? "," : "", geom.moves[line[i]].from + 1,
+                        geom.moves[line[i]].to + 1);
+        }
+        sink_printf(&out, "]%s", last ? "]}\n" : "");
+        return;
+    }
+
+    for (i = 0; i < nmoves; i += RECORD_MOVES) {
+        int n = (nmoves - i < RECORD_MOVES ? nmoves - i : RECORD_MOVES);
+
+        memset(rec, 0, sizeof(rec));
+        rec[0] = RECORD_MOVES_OF;
+        rec[1] = geom.side;
+        rec[3] = (i + n == nmoves ? RECORD_LAST : 0);
+        put_le(rec + 4, n, 4);
+        for (j = 0; j < n; j++) {
+            rec[8 + 2 * j] = geom.moves[line[i + j]].from + 1;
+            rec[9 + 2 * j] = geom.moves[line[i + j]].to + 1;
+        }
+        sink_write(&out, rec, sizeof(rec));
+    }
+}
+
+/*
+ * Like print_board(), but for a board of any size given as one flag
+ * per hole, with the peg in hole "last" (if any) highlighted.
+ */
+void
+print_holes(const unsigned char *pegs, int last)
 {
     int row;
     int col;
+    int h;
+    int width = (geom.side >= 10 ? 2 : 1);
 
-    for (row = 0; row < NUM_ROWS; row++) {
-        for (col = 0; col < NUM_COLS; col++) {
-            b->squares[row][col] &= ~POS_LAST;
+    if (visual && !debug) {
+        CURSOR_HOME;
+    }
+
+    printf("++++++++++++++++++++++\n");
+    printf("\n\n");
+    for (row = 0; row < geom.side; row++) {
+        printf("%*d    ", width, row + 1);
+        for (col = 0; col < geom.side - 1 - row; col++) {
+            printf(" ");
+        }
+        for (h = row * (row + 1) / 2; h < (row + 1) * (row + 2) / 2; h++) {
+            if (pegs[h]) {
+                if (h == last) {
+                    INVERSE_VIDEO;
+                }
+                printf("X");
+                if (h == last) {
+                    NORMAL_VIDEO;
+                }
+            } else {
+                printf(" ");
+            }
+            printf(" ");
         }
+        printf("\n");
+    }
+    printf("\n\n");
+    printf("----------------------\n\n");
+
+    if (visual && !debug) {
+        sleep(1);
     }
 }
 
-int
-generate_boards(struct board *b)
+/*
+ * Work out the holes and every possible jump on a triangle with n holes
+ * along each edge.
+ */
+void
+init_geometry(int n)
 {
-    struct board *newb;
     int row;
     int col;
+    int h;
+    int bit;
     int offnum;
-    int new_board_num = 0;
-    int count = count_pegs(b);
-    int prevnum;
 
-    b->boardnum = total_boards;
-    prevnum = (b->prev ? b->prev->boardnum : 0);
+    memset(&geom, 0, sizeof(geom));
+    geom.side = n;
+    memset(grid_hole, -1, sizeof(grid_hole));
 
-    if (debug) {
-        if (count == 1) {
-            printf("Board is a winner!\n");
+    for (bit = 0; bit < MAX_BITS; bit++) {
+        geom.hole_at[bit] = -1;
+        for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+            geom.move_at[bit][offnum] = -1;
         }
-        printf("DEPTH: %d COUNT: %d BOARDNUM %d PREV %d\n", depth, count, b->boardnum, prevnum);
-    }
-    depth++;
-    if (debug) {
-        print_board(b);
     }
 
-    if (count == 1) {
-        if (winning_board == NULL) {
-            winning_board = b;
+    h = 0;
+    for (row = 0; row < n; row++) {
+        for (col = 0; col <= row; col++) {
+            geom.row[h] = row;
+            geom.col[h] = col;
+            geom.bit[h] = row * n + col;
+            geom.hole_at[row * n + col] = h;
+            if (n == DEFAULT_SIDE) {
+                grid_hole[row + 2][NUM_COLS / 2 - row + 2 * col] = h;
+            }
+            h++;
         }
-        total_winning_boards++;
     }
+    geom.holes = h;
 
-    for (row = 0; row < NUM_ROWS; row++) {
-        for (col = 0; col < NUM_COLS; col++) {
-            if (!(b->squares[row][col] & POS_FULL)) {
-                continue;
-            }
+    for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+        geom.step[offnum] = trirowoffsets[offnum] * n + tricoloffsets[offnum];
+    }
 
-            for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
-                int roff = rowoffsets[offnum];
-                int coff = coloffsets[offnum];
-                if ((b->squares[row + roff][col + coff] & POS_FULL) && b->squares[row + 2 * roff][col + 2 * coff] == POS_EMPTY) {
-                    /* OK, we need to allocate a new board position, copy the old one and modify it */
-                    newb = calloc(1, sizeof(struct board));
-                    total_boards++;
-                    memcpy(&newb->squares, &b->squares, sizeof(newb->squares));
-                    clear_last(newb);
-                    newb->squares[row][col] = POS_EMPTY;
-                    newb->squares[row + roff][col + coff] = POS_EMPTY;
-                    newb->squares[row + 2 * roff][col + 2 * coff] = POS_FULL | POS_LAST;
+    for (h = 0; h < geom.holes; h++) {
+        for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+            int row2 = geom.row[h] + 2 * trirowoffsets[offnum];
+            int col2 = geom.col[h] + 2 * tricoloffsets[offnum];
+            struct move *m;
 
-                    b->next[new_board_num] = newb;
-                    newb->prev = b;
-                    new_board_num++;
-                    generate_boards(newb);
-                }
+            if (row2 < 0 || row2 >= n || col2 < 0 || col2 > row2) {
+                continue;
             }
+            m = &geom.moves[geom.nmoves];
+            m->from = h;
+            m->over = geom.hole_at[geom.bit[h] + geom.step[offnum]];
+            m->to = geom.hole_at[geom.bit[h] + 2 * geom.step[offnum]];
+            geom.move_at[geom.bit[m->to]][offnum] = geom.nmoves;
+            geom.mobility[m->from]++;
+            geom.mobility[m->over]++;
+            geom.nmoves++;
         }
     }
+}
 
-    depth--;
+/*
+ * SplitMix64: a small, fast generator, good enough to seed the Zobrist
+ * keys and anything else that needs well-mixed random bits.
+ */
+uint64_t
+splitmix64(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
 
-    if (new_board_num == 0) {
-        return FALSE;
-    } else {
-        return TRUE;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/*
+ * A random key per hole; a position's hash is the XOR of the keys of the
+ * holes with pegs in them.  The seed is fixed so hashes are the same
+ * from run to run.
+ */
+void
+init_zobrist(void)
+{
+    uint64_t state = 0x7472692d736f6cULL;
+    int h;
+
+    for (h = 0; h < MAX_HOLES; h++) {
+        zobrist[h] = splitmix64(&state);
     }
 }
 
-int
-main(int argc, char **argv)
+/* A jump empties two holes and fills one, so the hash changes by three keys */
+static inline uint64_t
+zobrist_jump(uint64_t hash, const struct move *mv)
 {
-    int c;
+    return hash ^ zobrist[mv->from] ^ zobrist[mv->over] ^ zobrist[mv->to];
+}
 
-    struct board initial_board_1 = { {
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
-        { _, _, _, _, _, _, X, _, _, _, _, _, _ },
-        { _, _, _, _, _, X, _, X, _, _, _, _, _ },
-        { _, _, _, _, X, _, O, _, X, _, _, _, _ },
-        { _, _, _, X, _, X, _, X, _, X, _, _, _ },
-        { _, _, X, _, X, _, X, _, X, _, X, _, _ },
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ } },
-        { NULL },
-        NULL, 0
+/*
+ * Hole (r,c) is (r - c, c, side - 1 - r) in barycentric terms, and the
+ * symmetries of the triangle are the six ways of permuting those.
+ */
+void
+init_symmetry(void)
+{
+    static const int perms[NUM_SYMMETRIES][3] = {
+        { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 1, 0, 2 }, { 0, 2, 1 }, { 2, 1, 0 }
     };
-    struct board initial_board_2 = { {
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
-        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
-        { _, _, _, _, _, _, O, _, _, _, _, _, _ },
-        { _, _, _, _, _, X, _, X, _, _, _, _, _ },
-        { _, _, _, _, X, _, X, _, X, _, _, _, _ },
+    int sym;
+    int h;
+    int chunk;
+    int v;
+    int bit;
+
+    for (sym = 0; sym < NUM_SYMMETRIES; sym++) {
+        for (h = 0; h < geom.holes; h++) {
+            int bary[3];
+            int image[3];
+            int i;
+
+            bary[0] = geom.row[h] - geom.col[h];
+            bary[1] = geom.col[h];
+            bary[2] = geom.side - 1 - geom.row[h];
+            for (i = 0; i < 3; i++) {
+                image[i] = bary[perms[sym][i]];
+            }
+            sym_perm[sym][h] = geom.hole_at[(geom.side - 1 - image[2]) * geom.side + image[1]];
+        }
+    }
+
+    if (geom.side * geom.side > 64) {
+        sym_chunks = 0;
+        return;
+    }
+    sym_chunks = (geom.side * geom.side + 7) / 8;
+    memset(sym_table, 0, sizeof(sym_table));
+    for (chunk = 0; chunk < sym_chunks; chunk++) {
+        for (v = 0; v < 256; v++) {
+            for (bit = 0; bit < 8; bit++) {
+                h = (8 * chunk + bit < MAX_BITS ? geom.hole_at[8 * chunk + bit] : -1);
+                if (!(v & (1 << bit)) || h < 0) {
+                    continue;
+                }
+                for (sym = 0; sym < NUM_SYMMETRIES; sym++) {
+                    sym_table[chunk][v][sym] |= (uint64_t)1 << geom.bit[sym_perm[sym][h]];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * The smallest of the six images of a bitboard, which is the same for
+ * every position in a symmetry class: one table load per byte.
+ */
+static inline uint64_t
+canonical64(uint64_t pegs)
+{
+    uint64_t image[NUM_SYMMETRIES] = { 0, 0, 0, 0, 0, 0 };
+    uint64_t best;
+    int chunk;
+    int sym;
+
+    for (chunk = 0; chunk < sym_chunks; chunk++) {
+        const uint64_t *t = sym_table[chunk][(pegs >> (8 * chunk)) & 0xff];
+
+        for (sym = 0; sym < NUM_SYMMETRIES; sym++) {
+            image[sym] |= t[sym];
+        }
+    }
+    best = image[0];
+    for (sym = 1; sym < NUM_SYMMETRIES; sym++) {
+        if (image[sym] < best) {
+            best = image[sym];
+        }
+    }
+    return best;
+}
+
+/* The same thing a hole at a time, for comparison */
+uint64_t
+canonical64_naive(uint64_t pegs)
+{
+    uint64_t best = UINT64_MAX;
+    int sym;
+    int h;
+
+    for (sym = 0; sym < NUM_SYMMETRIES; sym++) {
+        uint64_t image = 0;
+
+        for (h = 0; h < geom.holes; h++) {
+            if (pegs & ((uint64_t)1 << geom.bit[h])) {
+                image |= (uint64_t)1 << geom.bit[sym_perm[sym][h]];
+            }
+        }
+        if (image < best) {
+            best = image;
+        }
+    }
+    return best;
+}
+
+/* Spread the bits of a key about, for indexing by something other than a Zobrist hash */
+static inline uint64_t
+mix64(uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+double
+now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void
+stop_search(int sig)
+{
+    (void)sig;
+    atomic_store(&stopped, 1);
+}
+
+/* Look at the clock, and tell the reporter how the search is going */
+static void
+progress_sample(struct progress *p, int pegs)
+{
+    if (deadline > 0 && now() >= deadline) {
+        atomic_store(&stopped, 1);
+    }
+    atomic_store_explicit(&p->nodes, p->ticks, memory_order_relaxed);
+    atomic_store_explicit(&p->samples[pegs], atomic_load_explicit(&p->samples[pegs], memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+    if (p->fraction != NULL) {
+        atomic_store_explicit(&p->done, p->fraction(), memory_order_relaxed);
+    }
+}
+
+/* Whether to give up, for a search at a position with pegs pegs */
+static inline int
+out_of_time(struct progress *p, int pegs)
+{
+    if ((++p->ticks & (DEADLINE_CHECK - 1)) == 0) {
+        progress_sample(p, pegs);
+    }
+    return atomic_load_explicit(&stopped, memory_order_relaxed);
+}
+
+/* Note the line to the current position if it leaves fewer pegs than any so far */
+static inline void
+note_best(int count, int nmoves)
+{
+    int i;
+
+    if (count < best_pegs) {
+        best_pegs = count;
+        for (i = 0; i < nmoves; i++) {
+            best_path[i] = bb_path[i];
+        }
+    }
+}
+
+/*
+ * Counters are per process, counting user-space work only, and inherited
+ * by the search threads; a thread's counts are added in when it exits, so
+ * a phase's figures include every thread it joined.
+ */
+void
+profile_init(void)
+{
+#ifdef __linux__
+    static const uint64_t configs[NUM_COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    struct perf_event_attr attr;
+    int error = 0;
+    int opened = 0;
+    int i;
+
+    for (i = 0; i < NUM_COUNTERS; i++) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        counter_fd[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (counter_fd[i] < 0) {
+            error = errno;
+        } else if (read(counter_fd[i], &counter_last[i], sizeof(uint64_t)) != sizeof(uint64_t)) {
+            error = errno;
+            close(counter_fd[i]);
+            counter_fd[i] = -1;
+        } else {
+            opened++;
+        }
+    }
+    if (opened < NUM_COUNTERS) {
+        fprintf(stderr, "profile: %s hardware counters unavailable (%s)\n", opened == 0 ? "all" : "some",
+                strerror(error));
+    }
+#else
+    fprintf(stderr, "profile: hardware counters need Linux; showing times only\n");
+#endif
+    fprintf(stderr, "profile: %-8s %10s %16s %16s %14s %14s %6s\n", "phase", "seconds",
+            counter_names[0], counter_names[1], counter_names[2], counter_names[3], "IPC");
+    profile_last = now();
+}
+
+/*
+ * Report the counts since the last phase, and per node if the phase
+ * visited any: nodes are boards for the depth-first searches, table
+ * lookups for the hashed ones, positions for -x and games for -M.
+ */
+void
+profile_phase(const char *name, long long nodes)
+{
+    uint64_t delta[NUM_COUNTERS];
+    double t = now();
+    int i;
+
+    if (!profiling) {
+        return;
+    }
+    for (i = 0; i < NUM_COUNTERS; i++) {
+        uint64_t v = counter_last[i];
+
+        if (counter_fd[i] >= 0 && read(counter_fd[i], &v, sizeof(v)) != sizeof(v)) {
+            v = counter_last[i];
+        }
+        delta[i] = v - counter_last[i];
+        counter_last[i] = v;
+    }
+
+    fprintf(stderr, "profile: %-8s %10.4f", name, t - profile_last);
+    for (i = 0; i < NUM_COUNTERS; i++) {
+        if (counter_fd[i] >= 0) {
+            fprintf(stderr, " %*llu", i < 2 ? 16 : 14, (unsigned long long)delta[i]);
+        } else {
+            fprintf(stderr, " %*s", i < 2 ? 16 : 14, "-");
+        }
+    }
+    if (counter_fd[0] >= 0 && counter_fd[1] >= 0 && delta[0] > 0) {
+        fprintf(stderr, " %6.2f", (double)delta[1] / delta[0]);
+    }
+    fprintf(stderr, "\n");
+
+    if (nodes > 0) {
+        fprintf(stderr, "profile: %-8s %10.1f", "per node", 1e9 * (t - profile_last) / nodes);
+        for (i = 0; i < NUM_COUNTERS; i++) {
+            if (counter_fd[i] >= 0) {
+                fprintf(stderr, " %*.2f", i < 2 ? 16 : 14, (double)delta[i] / nodes);
+            } else {
+                fprintf(stderr, " %*s", i < 2 ? 16 : 14, "-");
+            }
+        }
+        fprintf(stderr, "  (ns, %lld nodes)\n", nodes);
+    }
+    profile_last = now();
+}
+
+/* Whatever happens after the search is output */
+void
+profile_finish(void)
+{
+    profile_phase("output", 0);
+}
+
+/*
+ * Fill in a grid board for the 5-sided triangle from the geometry,
+ * with every hole full except "hole".
+ */
+void
+setup_board(struct board *b, int hole)
+{
+    int row;
+    int col;
+    int h;
+
+    memset(b, 0, sizeof(*b));
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            b->squares[row][col] = POS_INVALID;
+        }
+    }
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            h = grid_hole[row][col];
+            if (h >= 0) {
+                b->squares[row][col] = (h == hole ? POS_EMPTY : POS_FULL);
+            }
+        }
+    }
+}
+
+/*
+ * The pegs on a grid board as a 64-bit bitboard.
+ */
+uint64_t
+board_pegs(struct board *b)
+{
+    uint64_t pegs = 0;
+    int row;
+    int col;
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (b->squares[row][col] & POS_FULL) {
+                pegs |= (uint64_t)1 << geom.bit[grid_hole[row][col]];
+            }
+        }
+    }
+    return pegs;
+}
+
+uint64_t
+board_hash(struct board *b)
+{
+    uint64_t hash = 0;
+    int row;
+    int col;
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (b->squares[row][col] & POS_FULL) {
+                hash ^= zobrist[grid_hole[row][col]];
+            }
+        }
+    }
+    return hash;
+}
+
+/*
+ * Each move takes one peg from each of the three colours (row + col) % 3,
+ * so the parity of the difference between any two colour counts never
+ * changes.  That rules out all but one colour for the last peg.
+ */
+static int
+colour_class(const int *count)
+{
+    return ((count[0] + count[1]) & 1) | ((count[1] + count[2]) & 1) << 1;
+}
+
+static void
+pagoda_add(void)
+{
+    struct pagoda p;
+    int h;
+    int i;
+
+    p.nholes = 0;
+    for (h = 0; h < geom.holes; h++) {
+        if (pagoda_target[h] & 2) {
+            p.holes[p.nholes++] = h;
+        }
+    }
+    for (i = 0; i < npagodas; i++) {
+        if (pagodas[i].nholes == p.nholes &&
+            memcmp(pagodas[i].holes, p.holes, p.nholes * sizeof(int)) == 0) {
+            return;
+        }
+    }
+    if (npagodas < MAX_PAGODAS) {
+        pagodas[npagodas++] = p;
+    }
+}
+
+/*
+ * Grow a set of holes (flagged with 2 in pagoda_target[]) until every jump
+ * into the set starts in it or passes over it, trying both ways of fixing
+ * each jump that doesn't.
+ */
+static void
+pagoda_grow(int size, int limit, int *found)
+{
+    const struct move *mv = NULL;
+    int m;
+
+    if (*found >= PAGODAS_PER_TARGET) {
+        return;
+    }
+    for (m = 0; m < geom.nmoves; m++) {
+        mv = &geom.moves[m];
+        if ((pagoda_target[mv->to] & 2) && !(pagoda_target[mv->from] & 2) && !(pagoda_target[mv->over] & 2)) {
+            break;
+        }
+    }
+    if (m == geom.nmoves) {
+        pagoda_add();
+        (*found)++;
+        return;
+    }
+    if (size == limit) {
+        return;
+    }
+
+    pagoda_target[mv->over] |= 2;
+    pagoda_grow(size + 1, limit, found);
+    pagoda_target[mv->over] &= ~2;
+
+    pagoda_target[mv->from] |= 2;
+    pagoda_grow(size + 1, limit, found);
+    pagoda_target[mv->from] &= ~2;
+}
+
+/*
+ * Work out where the last peg could finish from the given start (and
+ * goal, if any), and find the smallest pagoda sets covering each of
+ * those holes.
+ */
+void
+init_pagodas(int hole)
+{
+    int count[3] = { 0, 0, 0 };
+    int start_class;
+    int h;
+
+    for (h = 0; h < geom.holes; h++) {
+        if (h != hole) {
+            count[(geom.row[h] + geom.col[h]) % 3]++;
+        }
+    }
+    start_class = colour_class(count);
+
+    npagodas = 0;
+    for (h = 0; h < geom.holes; h++) {
+        int single[3] = { 0, 0, 0 };
+
+        single[(geom.row[h] + geom.col[h]) % 3] = 1;
+        pagoda_target[h] = (colour_class(single) == start_class &&
+                            (goal_hole == 0 || h == goal_hole - 1));
+    }
+
+    for (h = 0; h < geom.holes; h++) {
+        int limit;
+        int found = 0;
+
+        if (!pagoda_target[h]) {
+            continue;
+        }
+        pagoda_target[h] |= 2;
+        for (limit = 1; limit <= PAGODA_MAX_SIZE && found == 0; limit++) {
+            pagoda_grow(1, limit, &found);
+        }
+        pagoda_target[h] &= ~2;
+    }
+}
+
+void
+free_boards(struct board *b)
+{
+    int i;
+
+    for (i = 0; i < MAX_BOARDS && b->next[i] != NULL; i++) {
+        free_boards(b->next[i]);
+        free(b->next[i]);
+        mem_add(MEM_NODES, -(long long)sizeof(struct board));
+        b->next[i] = NULL;
+    }
+}
+
+int
+count_pegs(struct board *b)
+{
+    int row;
+    int col;
+    int count = 0;
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (b->squares[row][col] & POS_FULL) {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+void
+clear_last(struct board *b)
+{
+    int row;
+    int col;
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            b->squares[row][col] &= ~POS_LAST;
+        }
+    }
+}
+
+/*
+ * Room for one winning line, taken before the search starts, so a memory
+ * limit only cuts how many more lines are kept and never loses the first.
+ */
+void
+reserve_solution(void)
+{
+    int len = geom.holes - 2;
+
+    if (max_solutions < 1 || solutions_size > 0 || len < 1) {
+        return;
+    }
+    mem_need(MEM_SOLUTIONS, len * sizeof(move_index));
+    solutions = malloc(len * sizeof(move_index));
+    if (solutions == NULL) {
+        fprintf(stderr, "out of memory for a winning line\n");
+        exit(1);
+    }
+    solutions_size = 1;
+}
+
+/*
+ * Keep a winning line, if there is room for another.
+ */
+void
+record_solution(const int *path, int nmoves)
+{
+    int len = geom.holes - 2;
+    int i;
+
+    if (nmoves != len) {
+        return;
+    }
+    if (first_time < 0) {
+        first_time = now() - search_start;
+        first_boards = total_boards;
+        if (first_only) {
+            atomic_store(&stopped, 1);
+        }
+    }
+    if (nsolutions >= max_solutions) {
+        return;
+    }
+    if (nsolutions == solutions_size) {
+        long long grow = (solutions_size == 0 ? 16 : solutions_size);
+
+        if (!mem_fits(grow * len * sizeof(move_index))) {
+            fprintf(stderr, "memory limit reached: keeping %lld winning lines\n", nsolutions);
+            max_solutions = nsolutions;
+            return;
+        }
+        mem_add(MEM_SOLUTIONS, grow * len * sizeof(move_index));
+        solutions_size += grow;
+        solutions = realloc(solutions, solutions_size * len * sizeof(move_index));
+        if (solutions == NULL) {
+            fprintf(stderr, "out of memory for %lld winning lines\n", solutions_size);
+            exit(1);
+        }
+    }
+    for (i = 0; i < len; i++) {
+        solutions[nsolutions * len + i] = path[i];
+    }
+    nsolutions++;
+}
+
+int
+generate_boards(struct board *b)
+{
+    struct board *newb;
+    int row;
+    int col;
+    int offnum;
+    int new_board_num = 0;
+    int count = count_pegs(b);
+    int prevnum;
+    uint64_t pegs = 0;
+
+    b->boardnum = total_boards;
+    prevnum = (b->prev ? b->prev->boardnum : 0);
+    if (out_of_time(&main_progress, count)) {
+        return FALSE;
+    }
+    note_best(count, depth);
+
+    if (debug) {
+        if (count == 1) {
+            printf("Board is a winner!\n");
+        }
+        printf("DEPTH: %d COUNT: %d BOARDNUM %d PREV %d HASH %016llx\n", depth, count, b->boardnum, prevnum,
+               (unsigned long long)b->hash);
+    }
+    depth++;
+    if (debug) {
+        print_board(b);
+    }
+
+    if (count == 1 && (goal_hole == 0 || board_pegs(b) == (uint64_t)1 << geom.bit[goal_hole - 1])) {
+        record_solution(bb_path, depth - 1);
+        total_winning_boards++;
+    }
+
+    if (pagoda) {
+        pegs = board_pegs(b);
+    }
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (!(b->squares[row][col] & POS_FULL)) {
+                continue;
+            }
+
+            for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+                int roff = rowoffsets[offnum];
+                int coff = coloffsets[offnum];
+
+                /* Stopped: leave the rest of the moves alone on the way out */
+                if (atomic_load_explicit(&stopped, memory_order_relaxed)) {
+                    break;
+                }
+                if ((b->squares[row + roff][col + coff] & POS_FULL) && b->squares[row + 2 * roff][col + 2 * coff] == POS_EMPTY) {
+                    if (pagoda) {
+                        uint64_t child = pegs;
+
+                        child ^= (uint64_t)1 << geom.bit[grid_hole[row][col]];
+                        child ^= (uint64_t)1 << geom.bit[grid_hole[row + roff][col + coff]];
+                        child ^= (uint64_t)1 << geom.bit[grid_hole[row + 2 * roff][col + 2 * coff]];
+                        if (pagoda_dead(child)) {
+                            pagoda_cuts++;
+                            continue;
+                        }
+                    }
+
+                    /*
+                     * Out of memory for boards: search what's below this move on a
+                     * single board instead, without keeping the tree.
+                     */
+                    if (!mem_fits(sizeof(struct board))) {
+                        struct board work;
+                        int from = grid_hole[row][col];
+                        int over = grid_hole[row + roff][col + coff];
+                        int to = grid_hole[row + 2 * roff][col + 2 * coff];
+
+                        if (!low_memory) {
+                            fprintf(stderr, "memory limit reached after %lld boards; searching the rest in place\n",
+                                    total_boards);
+                            low_memory = 1;
+                        }
+                        total_boards++;
+                        memcpy(&work.squares, &b->squares, sizeof(work.squares));
+                        clear_last(&work);
+                        work.squares[row][col] = POS_EMPTY;
+                        work.squares[row + roff][col + coff] = POS_EMPTY;
+                        work.squares[row + 2 * roff][col + 2 * coff] = POS_FULL;
+                        work.hash = b->hash ^ zobrist[from] ^ zobrist[over] ^ zobrist[to];
+                        bb_path[depth - 1] = geom.move_at[geom.bit[to]][offnum];
+                        inplace_boards(&work, count - 1, board_pegs(&work));
+                        continue;
+                    }
+
+                    /* OK, we need to allocate a new board position, copy the old one and modify it */
+                    newb = calloc(1, sizeof(struct board));
+                    mem_add(MEM_NODES, sizeof(struct board));
+                    total_boards++;
+                    memcpy(&newb->squares, &b->squares, sizeof(newb->squares));
+                    clear_last(newb);
+                    newb->squares[row][col] = POS_EMPTY;
+                    newb->squares[row + roff][col + coff] = POS_EMPTY;
+                    newb->squares[row + 2 * roff][col + 2 * coff] = POS_FULL | POS_LAST;
+                    newb->hash = b->hash ^ zobrist[grid_hole[row][col]] ^
+                                 zobrist[grid_hole[row + roff][col + coff]] ^
+                                 zobrist[grid_hole[row + 2 * roff][col + 2 * coff]];
+
+                    b->next[new_board_num] = newb;
+                    newb->prev = b;
+                    new_board_num++;
+                    bb_path[depth - 1] = geom.move_at[geom.bit[grid_hole[row + 2 * roff][col + 2 * coff]]][offnum];
+                    generate_boards(newb);
+                }
+            }
+        }
+    }
+
+    depth--;
+
+    if (new_board_num == 0) {
+        return FALSE;
+    } else {
+        return TRUE;
+    }
+}
+
+/*
+ * The same search as generate_boards(), but on a single working board:
+ * each jump is made, searched below and taken back, so nothing is copied
+ * or allocated per board.  The moves made so far are kept in bb_path[] for
+ * recording winning lines.
+ */
+void
+inplace_boards(struct board *b, int count, uint64_t pegs)
+{
+    int row;
+    int col;
+    int offnum;
+
+    if (debug) {
+        if (count == 1) {
+            printf("Board is a winner!\n");
+        }
+        printf("DEPTH: %d COUNT: %d BOARDNUM %lld HASH %016llx\n", depth, count, total_boards,
+               (unsigned long long)b->hash);
+        print_board(b);
+    }
+
+    if (out_of_time(&main_progress, count)) {
+        return;
+    }
+    note_best(count, depth);
+    if (count == 1 && (goal_hole == 0 || pegs == (uint64_t)1 << geom.bit[goal_hole - 1])) {
+        record_solution(bb_path, depth);
+        total_winning_boards++;
+    }
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (!(b->squares[row][col] & POS_FULL)) {
+                continue;
+            }
+
+            for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+                int roff = rowoffsets[offnum];
+                int coff = coloffsets[offnum];
+                int from = grid_hole[row][col];
+                int over;
+                int to;
+                uint64_t child;
+
+                if (atomic_load_explicit(&stopped, memory_order_relaxed)) {
+                    break;
+                }
+                if (!(b->squares[row + roff][col + coff] & POS_FULL) || b->squares[row + 2 * roff][col + 2 * coff] != POS_EMPTY) {
+                    continue;
+                }
+                over = grid_hole[row + roff][col + coff];
+                to = grid_hole[row + 2 * roff][col + 2 * coff];
+                child = pegs ^ ((uint64_t)1 << geom.bit[from]) ^ ((uint64_t)1 << geom.bit[over]) ^
+                        ((uint64_t)1 << geom.bit[to]);
+                if (pagoda && pagoda_dead(child)) {
+                    pagoda_cuts++;
+                    continue;
+                }
+
+                /* Make the jump, search below it, and take it back */
+                total_boards++;
+                b->squares[row][col] = POS_EMPTY;
+                b->squares[row + roff][col + coff] = POS_EMPTY;
+                b->squares[row + 2 * roff][col + 2 * coff] = POS_FULL;
+                b->hash ^= zobrist[from] ^ zobrist[over] ^ zobrist[to];
+                bb_path[depth++] = geom.move_at[geom.bit[to]][offnum];
+
+                inplace_boards(b, count - 1, child);
+
+                depth--;
+                b->hash ^= zobrist[from] ^ zobrist[over] ^ zobrist[to];
+                b->squares[row][col] = POS_FULL;
+                b->squares[row + roff][col + coff] = POS_FULL;
+                b->squares[row + 2 * roff][col + 2 * coff] = POS_EMPTY;
+            }
+        }
+    }
+}
+
+/*
+ * The reverse of the moves in generate_boards(): a peg jumps back over an
+ * empty hole into another empty hole, and the peg it jumped over comes
+ * back.  Each position that could have led to this one is put in prevs[],
+ * and the number of them is returned.
+ */
+int
+unjump_boards(struct board *b, struct squares *prevs)
+{
+    int row;
+    int col;
+    int offnum;
+    int n = 0;
+
+    for (row = 0; row < NUM_ROWS; row++) {
+        for (col = 0; col < NUM_COLS; col++) {
+            if (!(b->squares[row][col] & POS_FULL)) {
+                continue;
+            }
+
+            for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {
+                int roff = rowoffsets[offnum];
+                int coff = coloffsets[offnum];
+                if (b->squares[row + roff][col + coff] == POS_EMPTY && b->squares[row + 2 * roff][col + 2 * coff] == POS_EMPTY) {
+                    memcpy(prevs[n].s, b->squares, sizeof(prevs[n].s));
+                    prevs[n].s[row][col] = POS_EMPTY;
+                    prevs[n].s[row + roff][col + coff] = POS_FULL;
+                    prevs[n].s[row + 2 * roff][col + 2 * coff] = POS_FULL;
+                    n++;
+                }
+            }
+        }
+    }
+
+    return n;
+}
+
+/*
+ * Bitboard words.  Each width supplies the same handful of operations;
+ * shifts are only ever by less than 64 bits.
+ */
+typedef uint64_t bb64;
+typedef unsigned __int128 bb128;
+
+static inline bb64 bb64_zero(void) { return 0; }
+static inline bb64 bb64_bit(int i) { return (bb64)1 << i; }
+static inline bb64 bb64_and(bb64 a, bb64 b) { return a & b; }
+static inline bb64 bb64_or(bb64 a, bb64 b) { return a | b; }
+static inline bb64 bb64_xor(bb64 a, bb64 b) { return a ^ b; }
+static inline bb64 bb64_andnot(bb64 a, bb64 b) { return a & ~b; }
+static inline bb64 bb64_shl(bb64 a, int k) { return a << k; }
+static inline bb64 bb64_shr(bb64 a, int k) { return a >> k; }
+static inline int bb64_is_zero(bb64 a) { return a == 0; }
+static inline int bb64_lsb(bb64 a) { return __builtin_ctzll(a); }
+static inline bb64 bb64_clear_lsb(bb64 a) { return a & (a - 1); }
+static inline int bb64_popcount(bb64 a) { return __builtin_popcountll(a); }
+
+static inline bb128 bb128_zero(void) { return 0; }
+static inline bb128 bb128_bit(int i) { return (bb128)1 << i; }
+static inline bb128 bb128_and(bb128 a, bb128 b) { return a & b; }
+static inline bb128 bb128_or(bb128 a, bb128 b) { return a | b; }
+static inline bb128 bb128_xor(bb128 a, bb128 b) { return a ^ b; }
+static inline bb128 bb128_andnot(bb128 a, bb128 b) { return a & ~b; }
+static inline bb128 bb128_shl(bb128 a, int k) { return a << k; }
+static inline bb128 bb128_shr(bb128 a, int k) { return a >> k; }
+static inline int bb128_is_zero(bb128 a) { return a == 0; }
+static inline bb128 bb128_clear_lsb(bb128 a) { return a & (a - 1); }
+
+static inline int
+bb128_lsb(bb128 a)
+{
+    uint64_t lo = (uint64_t)a;
+
+    return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t)(a >> 64));
+}
+
+static inline int
+bb128_popcount(bb128 a)
+{
+    return __builtin_popcountll((uint64_t)a) + __builtin_popcountll((uint64_t)(a >> 64));
+}
+
+#ifdef __AVX2__
+typedef __m256i bb256;
+
+static inline bb256 bb256_zero(void) { return _mm256_setzero_si256(); }
+static inline bb256 bb256_and(bb256 a, bb256 b) { return _mm256_and_si256(a, b); }
+static inline bb256 bb256_or(bb256 a, bb256 b) { return _mm256_or_si256(a, b); }
+static inline bb256 bb256_xor(bb256 a, bb256 b) { return _mm256_xor_si256(a, b); }
+static inline bb256 bb256_andnot(bb256 a, bb256 b) { return _mm256_andnot_si256(b, a); }
+static inline int bb256_is_zero(bb256 a) { return _mm256_testz_si256(a, a); }
+
+static inline bb256
+bb256_bit(int i)
+{
+    uint64_t w[4] = { 0, 0, 0, 0 };
+
+    w[i >> 6] = (uint64_t)1 << (i & 63);
+    return _mm256_loadu_si256((const __m256i *)w);
+}
+
+/* Shift each lane, then carry the bits that fell off in from the next lane down */
+static inline bb256
+bb256_shl(bb256 a, int k)
+{
+    bb256 carry = _mm256_permute4x64_epi64(a, _MM_SHUFFLE(2, 1, 0, 3));
+
+    carry = _mm256_blend_epi32(carry, _mm256_setzero_si256(), 0x03);
+    return _mm256_or_si256(_mm256_sll_epi64(a, _mm_cvtsi32_si128(k)),
+                           _mm256_srl_epi64(carry, _mm_cvtsi32_si128(64 - k)));
+}
+
+static inline bb256
+bb256_shr(bb256 a, int k)
+{
+    bb256 carry = _mm256_permute4x64_epi64(a, _MM_SHUFFLE(0, 3, 2, 1));
+
+    carry = _mm256_blend_epi32(carry, _mm256_setzero_si256(), 0xc0);
+    return _mm256_or_si256(_mm256_srl_epi64(a, _mm_cvtsi32_si128(k)),
+                           _mm256_sll_epi64(carry, _mm_cvtsi32_si128(64 - k)));
+}
+
+static inline int
+bb256_lsb(bb256 a)
+{
+    uint64_t w[4];
+    int i;
+
+    _mm256_storeu_si256((__m256i *)w, a);
+    for (i = 0; w[i] == 0; i++) {
+        ;
+    }
+    return 64 * i + __builtin_ctzll(w[i]);
+}
+
+static inline bb256
+bb256_clear_lsb(bb256 a)
+{
+    uint64_t w[4];
+    int i;
+
+    _mm256_storeu_si256((__m256i *)w, a);
+    for (i = 0; w[i] == 0; i++) {
+        ;
+    }
+    w[i] &= w[i] - 1;
+    return _mm256_loadu_si256((const __m256i *)w);
+}
+
+static inline int
+bb256_popcount(bb256 a)
+{
+    uint64_t w[4];
+
+    _mm256_storeu_si256((__m256i *)w, a);
+    return __builtin_popcountll(w[0]) + __builtin_popcountll(w[1]) +
+           __builtin_popcountll(w[2]) + __builtin_popcountll(w[3]);
+}
+#endif
+
+/*
+ * The portable 256-bit word.  With AVX2 the search uses bb256 instead,
+ * but random playouts stay on this one: they spend their time finding
+ * and clearing single bits, which the vector word does through memory.
+ * GCC's vectorizer turns this word's four-step loops into slower vector
+ * code when AVX2 is on, so it is kept away from them and their engine.
+ */
+#ifdef __AVX2__
+#pragma GCC push_options
+#pragma GCC optimize("no-tree-vectorize")
+#endif
+typedef struct {
+    uint64_t w[4];
+} bbp256;
+
+static inline bbp256
+bbp256_zero(void)
+{
+    bbp256 r = { { 0, 0, 0, 0 } };
+
+    return r;
+}
+
+static inline bbp256
+bbp256_bit(int i)
+{
+    bbp256 r = { { 0, 0, 0, 0 } };
+
+    r.w[i >> 6] = (uint64_t)1 << (i & 63);
+    return r;
+}
+
+static inline bbp256
+bbp256_and(bbp256 a, bbp256 b)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        a.w[i] &= b.w[i];
+    }
+    return a;
+}
+
+static inline bbp256
+bbp256_or(bbp256 a, bbp256 b)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        a.w[i] |= b.w[i];
+    }
+    return a;
+}
+
+static inline bbp256
+bbp256_xor(bbp256 a, bbp256 b)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        a.w[i] ^= b.w[i];
+    }
+    return a;
+}
+
+static inline bbp256
+bbp256_andnot(bbp256 a, bbp256 b)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        a.w[i] &= ~b.w[i];
+    }
+    return a;
+}
+
+static inline bbp256
+bbp256_shl(bbp256 a, int k)
+{
+    int i;
+
+    for (i = 3; i > 0; i--) {
+        a.w[i] = (a.w[i] << k) | (a.w[i - 1] >> (64 - k));
+    }
+    a.w[0] <<= k;
+    return a;
+}
+
+static inline bbp256
+bbp256_shr(bbp256 a, int k)
+{
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        a.w[i] = (a.w[i] >> k) | (a.w[i + 1] << (64 - k));
+    }
+    a.w[3] >>= k;
+    return a;
+}
+
+static inline int
+bbp256_is_zero(bbp256 a)
+{
+    return (a.w[0] | a.w[1] | a.w[2] | a.w[3]) == 0;
+}
+
+static inline int
+bbp256_lsb(bbp256 a)
+{
+    int i;
+
+    for (i = 0; a.w[i] == 0; i++) {
+        ;
+    }
+    return 64 * i + __builtin_ctzll(a.w[i]);
+}
+
+static inline bbp256
+bbp256_clear_lsb(bbp256 a)
+{
+    int i;
+
+    for (i = 0; a.w[i] == 0; i++) {
+        ;
+    }
+    a.w[i] &= a.w[i] - 1;
+    return a;
+}
+
+static inline int
+bbp256_popcount(bbp256 a)
+{
+    return __builtin_popcountll(a.w[0]) + __builtin_popcountll(a.w[1]) +
+           __builtin_popcountll(a.w[2]) + __builtin_popcountll(a.w[3]);
+}
+#ifdef __AVX2__
+#pragma GCC pop_options
+#endif
+
+/*
+ * The bitboard engine, stamped out once per word width W.
+ *
+ * For a jump in direction d the destination t is empty and the holes one
+ * and two steps back along d both have pegs, so shifting the pegs by one
+ * and two steps and ANDing with the empty holes gives every destination
+ * for that direction at once.
+ */
+#define BITBOARD_ENGINE(W)                                                  \
+                                                                            \
+static bb##W bb##W##_valid;                                                 \
+static bb##W bb##W##_hole[MAX_HOLES];                                       \
+static bb##W bb##W##_pagoda[MAX_PAGODAS];                                   \
+static bb##W bb##W##_targets;                                               \
+static bb##W bb##W##_root;                                                  \
+                                                                            \
+static void                                                                 \
+bb##W##_init(void)                                                          \
+{                                                                           \
+    int h;                                                                  \
+    int i;                                                                  \
+                                                                            \
+    bb##W##_valid = bb##W##_zero();                                         \
+    bb##W##_targets = bb##W##_zero();                                       \
+    for (h = 0; h < geom.holes; h++) {                                      \
+        bb##W##_hole[h] = bb##W##_bit(geom.bit[h]);                         \
+        bb##W##_valid = bb##W##_or(bb##W##_valid, bb##W##_hole[h]);         \
+        if (pagoda_target[h]) {                                             \
+            bb##W##_targets = bb##W##_or(bb##W##_targets, bb##W##_hole[h]); \
+        }                                                                   \
+    }                                                                       \
+    for (i = 0; i < npagodas; i++) {                                        \
+        bb##W##_pagoda[i] = bb##W##_zero();                                 \
+        for (h = 0; h < pagodas[i].nholes; h++) {                           \
+            bb##W##_pagoda[i] = bb##W##_or(bb##W##_pagoda[i],               \
+                                           bb##W##_hole[pagodas[i].holes[h]]); \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+/* True if every hole the last peg could finish in is in an empty pagoda */ \
+static inline int                                                           \
+bb##W##_dead(bb##W pegs)                                                    \
+{                                                                           \
+    bb##W reachable = bb##W##_targets;                                      \
+    int i;                                                                  \
+                                                                            \
+    for (i = 0; i < npagodas; i++) {                                        \
+        if (bb##W##_is_zero(bb##W##_and(pegs, bb##W##_pagoda[i]))) {        \
+            reachable = bb##W##_andnot(reachable, bb##W##_pagoda[i]);       \
+        }                                                                   \
+    }                                                                       \
+    return bb##W##_is_zero(reachable);                                      \
+}                                                                           \
+                                                                            \
+static inline bb##W                                                         \
+bb##W##_step(bb##W a, int step)                                             \
+{                                                                           \
+    return step > 0 ? bb##W##_shl(a, step) : bb##W##_shr(a, -step);         \
+}                                                                           \
+                                                                            \
+static int                                                                  \
+bb##W##_gen_moves(bb##W pegs, int *moves)                                   \
+{                                                                           \
+    bb##W empty = bb##W##_andnot(bb##W##_valid, pegs);                      \
+    bb##W targets;                                                          \
+    int offnum;                                                             \
+    int n = 0;                                                              \
+                                                                            \
+    for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {                      \
+        int step = geom.step[offnum];                                       \
+                                                                            \
+        targets = bb##W##_and(empty,                                        \
+                              bb##W##_and(bb##W##_step(pegs, step),         \
+                                          bb##W##_step(pegs, 2 * step)));   \
+        while (!bb##W##_is_zero(targets)) {                                 \
+            moves[n++] = geom.move_at[bb##W##_lsb(targets)][offnum];        \
+            targets = bb##W##_clear_lsb(targets);                           \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    return n;                                                               \
+}                                                                           \
+                                                                            \
+static inline uint64_t                                                      \
+bb##W##_hash(bb##W pegs)                                                    \
+{                                                                           \
+    uint64_t hash = 0;                                                      \
+    int h;                                                                  \
+                                                                            \
+    for (h = 0; h < geom.holes; h++) {                                      \
+        if (!bb##W##_is_zero(bb##W##_and(pegs, bb##W##_hole[h]))) {         \
+            hash ^= zobrist[h];                                             \
+        }                                                                   \
+    }                                                                       \
+    return hash;                                                            \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * The same trick backwards: a peg at t can have arrived by jump d when the \
+ * holes one and two steps back along d are both empty.  The move numbers   \
+ * are those of the forward jumps being undone, and since a jump only       \
+ * flips three bits, bb##W##_apply() undoes one as well as doing it.        \
+ */                                                                         \
+static int                                                                  \
+bb##W##_gen_unjumps(bb##W pegs, int *moves)                                 \
+{                                                                           \
+    bb##W empty = bb##W##_andnot(bb##W##_valid, pegs);                      \
+    bb##W targets;                                                          \
+    int offnum;                                                             \
+    int n = 0;                                                              \
+                                                                            \
+    for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {                      \
+        int step = geom.step[offnum];                                       \
+                                                                            \
+        targets = bb##W##_and(pegs,                                         \
+                              bb##W##_and(bb##W##_step(empty, step),        \
+                                          bb##W##_step(empty, 2 * step)));  \
+        while (!bb##W##_is_zero(targets)) {                                 \
+            moves[n++] = geom.move_at[bb##W##_lsb(targets)][offnum];        \
+            targets = bb##W##_clear_lsb(targets);                           \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    return n;                                                               \
+}                                                                           \
+                                                                            \
+static inline bb##W                                                         \
+bb##W##_apply(bb##W pegs, int m)                                            \
+{                                                                           \
+    const struct move *mv = &geom.moves[m];                                \
+                                                                            \
+    pegs = bb##W##_xor(pegs, bb##W##_hole[mv->from]);                       \
+    pegs = bb##W##_xor(pegs, bb##W##_hole[mv->over]);                       \
+    return bb##W##_xor(pegs, bb##W##_hole[mv->to]);                         \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * Pegs with no peg next to them: they can't jump, and can only be taken    \
+ * once another peg lands beside them.                                      \
+ */                                                                         \
+static inline int                                                           \
+bb##W##_isolated(bb##W pegs)                                                \
+{                                                                           \
+    bb##W near = bb##W##_zero();                                            \
+    int offnum;                                                             \
+                                                                            \
+    for (offnum = 0; offnum < NUM_OFFSETS; offnum++) {                      \
+        near = bb##W##_or(near, bb##W##_step(pegs, geom.step[offnum]));     \
+    }                                                                       \
+    return bb##W##_popcount(bb##W##_andnot(pegs, near));                    \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * Put the moves most likely to lead to a win first, keeping the generated  \
+ * order among equals, for finding a first win sooner.  Isolated pegs are   \
+ * worst, then pegs in holes few moves pass through (the corners), so the   \
+ * score is those left after the move, the cost of the hard-to-move pegs    \
+ * left being the cost of the move's own three holes.                       \
+ */                                                                         \
+static void                                                                 \
+bb##W##_order_moves(bb##W pegs, int *moves, int n)                          \
+{                                                                           \
+    int score[MAX_MOVES];                                                   \
+    int i;                                                                  \
+    int j;                                                                  \
+                                                                            \
+    for (i = 0; i < n; i++) {                                               \
+        int m = moves[i];                                                   \
+        const struct move *mv = &geom.moves[m];                             \
+        int sc = 10 * bb##W##_isolated(bb##W##_apply(pegs, m)) +            \
+                 geom.mobility[mv->from] + geom.mobility[mv->over] - geom.mobility[mv->to];\
+                                                                            \
+        for (j = i; j > 0 && score[j - 1] > sc; j--) {                      \
+            moves[j] = moves[j - 1];                                        \
+            score[j] = score[j - 1];                                        \
+        }                                                                   \
+        moves[j] = m;                                                       \
+        score[j] = sc;                                                      \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+bb##W##_search(bb##W pegs, int count)                                       \
+{                                                                           \
+    int moves[MAX_MOVES];                                                   \
+    int n;                                                                  \
+    int i;                                                                  \
+                                                                            \
+    if (out_of_time(&main_progress, count)) {                               \
+        return;                                                             \
+    }                                                                       \
+    note_best(count, depth);                                                \
+    if (count == 1 &&                                                       \
+        (goal_hole == 0 ||                                                  \
+         !bb##W##_is_zero(bb##W##_and(pegs, bb##W##_hole[goal_hole - 1])))) { \
+        record_solution(bb_path, depth);                                    \
+        total_winning_boards++;                                             \
+    }                                                                       \
+                                                                            \
+    n = bb##W##_gen_moves(pegs, moves);                                     \
+    if (first_only) {                                                       \
+        bb##W##_order_moves(pegs, moves, n);                                \
+    }                                                                       \
+    for (i = 0; i < n; i++) {                                               \
+        bb##W child = bb##W##_apply(pegs, moves[i]);                        \
+                                                                            \
+        if (pagoda && bb##W##_dead(child)) {                                \
+            pagoda_cuts++;                                                  \
+            continue;                                                       \
+        }                                                                   \
+        total_boards++;                                                     \
+        bb_path[depth++] = moves[i];                                        \
+        bb##W##_search(child, count - 1);                                   \
+        depth--;                                                            \
+        if (atomic_load_explicit(&stopped, memory_order_relaxed)) {         \
+            break;                                                          \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * How much of the tree lies behind the current position, taking subtrees   \
+ * on each of the top PROGRESS_LEVELS levels to be the same size.  The      \
+ * moves on the path are found again in the order the search tries them.    \
+ */                                                                         \
+static double                                                               \
+bb##W##_fraction(void)                                                      \
+{                                                                           \
+    int moves[MAX_MOVES];                                                   \
+    bb##W pegs = bb##W##_root;                                              \
+    double done = 0;                                                        \
+    double width = 1;                                                       \
+    int d;                                                                  \
+    int n;                                                                  \
+    int i;                                                                  \
+                                                                            \
+    for (d = 0; d < depth && d < PROGRESS_LEVELS; d++) {                    \
+        n = bb##W##_gen_moves(pegs, moves);                                 \
+        if (first_only) {                                                   \
+            bb##W##_order_moves(pegs, moves, n);                            \
+        }                                                                   \
+        for (i = 0; i < n && moves[i] != bb_path[d]; i++) {                 \
+        }                                                                   \
+        width /= n;                                                         \
+        done += i * width;                                                  \
+        pegs = bb##W##_apply(pegs, bb_path[d]);                             \
+    }                                                                       \
+    return done;                                                            \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * Play random games from the starting position, picking uniformly among    \
+ * the legal moves each time, until the thread has played its share.       \
+ */                                                                         \
+static void                                                                 \
+bb##W##_playouts(int hole, long long games, struct playout_worker *w)       \
+{                                                                           \
+    bb##W start = bb##W##_xor(bb##W##_valid, bb##W##_hole[hole]);           \
+    int moves[MAX_MOVES];                                                   \
+    long long g;                                                            \
+                                                                            \
+    for (g = 0; g < games; g++) {                                           \
+        bb##W pegs = start;                                                 \
+        int count = geom.holes - 1;                                         \
+        int n;                                                              \
+                                                                            \
+        while ((n = bb##W##_gen_moves(pegs, moves)) > 0) {                  \
+            uint64_t r = splitmix64(&w->rng) >> 32;                         \
+                                                                            \
+            pegs = bb##W##_apply(pegs, moves[(r * n) >> 32]);               \
+            count--;                                                        \
+        }                                                                   \
+        w->pegs_left[count]++;                                              \
+        if (count == 1 &&                                                   \
+            (goal_hole == 0 ||                                              \
+             !bb##W##_is_zero(bb##W##_and(pegs, bb##W##_hole[goal_hole - 1])))) { \
+            w->wins++;                                                      \
+        }                                                                   \
+    }                                                                       \
+    w->games += games;                                                      \
+}                                                                           \
+                                                                            \
+/*                                                                          \
+ * Check on random positions that every jump is undone by one of the        \
+ * unjumps from where it lands, and every unjump by one of the jumps from   \
+ * where it leads.  Returns the number of mismatches.                       \
+ */                                                                         \
+static int                                                                  \
+bb##W##_check_unjumps(int positions, uint64_t *rng)                         \
+{                                                                           \
+    int moves[MAX_MOVES];                                                   \
+    int back[MAX_MOVES];                                                    \
+    int failures = 0;                                                       \
+    int p;                                                                  \
+                                                                            \
+    bb##W##_init();                                                         \
+    for (p = 0; p < positions; p++) {                                       \
+        bb##W pegs = bb##W##_zero();                                        \
+        int h;                                                              \
+        int n;                                                              \
+        int i;                                                              \
+                                                                            \
+        for (h = 0; h < geom.holes; h++) {                                  \
+            if (splitmix64(rng) & 1) {                                      \
+                pegs = bb##W##_or(pegs, bb##W##_hole[h]);                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        n = bb##W##_gen_moves(pegs, moves);                                 \
+        for (i = 0; i < n; i++) {                                           \
+            int nback = bb##W##_gen_unjumps(bb##W##_apply(pegs, moves[i]), back); \
+                                                                            \
+            while (nback > 0 && back[nback - 1] != moves[i]) {              \
+                nback--;                                                    \
+            }                                                               \
+            failures += (nback == 0);                                       \
+        }                                                                   \
+                                                                            \
+        n = bb##W##_gen_unjumps(pegs, moves);                               \
+        for (i = 0; i < n; i++) {                                           \
+            int nfwd = bb##W##_gen_moves(bb##W##_apply(pegs, moves[i]), back); \
+                                                                            \
+            while (nfwd > 0 && back[nfwd - 1] != moves[i]) {                \
+                nfwd--;                                                     \
+            }                                                               \
+            failures += (nfwd == 0);                                        \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    return failures;                                                        \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+bb##W##_solve(int hole)                                                     \
+{                                                                           \
+    bb##W start;                                                            \
+                                                                            \
+    bb##W##_init();                                                         \
+    start = bb##W##_xor(bb##W##_valid, bb##W##_hole[hole]);                 \
+    bb##W##_root = start;                                                   \
+    main_progress.fraction = bb##W##_fraction;                              \
+    bb##W##_search(start, geom.holes - 1);                                  \
+    main_progress.fraction = NULL;                                          \
+}
+
+BITBOARD_ENGINE(64)
+BITBOARD_ENGINE(128)
+#ifdef __AVX2__
+#pragma GCC push_options
+#pragma GCC optimize("no-tree-vectorize")
+#endif
+BITBOARD_ENGINE(p256)
+#ifdef __AVX2__
+#pragma GCC pop_options
+#endif
+#ifdef __AVX2__
+BITBOARD_ENGINE(256)
+#endif
+
+int
+pagoda_dead(uint64_t pegs)
+{
+    return bb64_dead(pegs);
+}
+
+/*
+ * Run the bitboard engine with the narrowest word the board fits in.
+ */
+void
+bitboard_solve(int hole)
+{
+    if (geom.side * geom.side <= 64) {
+        bb64_solve(hole);
+    } else if (geom.side * geom.side <= 128) {
+        bb128_solve(hole);
+    } else {
+#ifdef __AVX2__
+        bb256_solve(hole);
+#else
+        bbp256_solve(hole);
+#endif
+    }
+}
+
+/*
+ * Transposition table shared by the search threads.
+ *
+ * A position's subtree - how many boards and winning boards lie below it -
+ * doesn't depend on how it was reached, so it is worked out once and kept
+ * here.  The table is a fixed-size array probed from the Zobrist hash,
+ * keyed by the bitboard itself (never 0, as there's always a peg).
+ * Threads claim an empty or victim slot by compare-and-swap on the key,
+ * then write the counts and last a check word, the XOR of the other three,
+ * so a reader that races with a writer sees a mismatch and treats it as a
+ * miss rather than taking half an entry.  Nobody ever waits on a lock.
+ */
+struct tt_entry {
+    _Atomic uint64_t key;
+    _Atomic uint64_t nodes;
+    _Atomic uint64_t wins;
+    _Atomic uint64_t check;
+};
+
+struct tt_stats {
+    long long hits;
+    long long misses;
+    long long collisions;
+    long long replaced;
+};
+
+struct tt_entry *tt;
+size_t tt_mask;
+struct tt_stats tt_totals;
+
+/*
+ * The entries for a table of at most bytes, cut to fit under -L, or 0 if
+ * the cut leaves too small a table to search with.
+ */
+static size_t
+tt_entries(long long bytes, size_t *wanted)
+{
+    size_t entries = 1;
+
+    while (entries * 2 * sizeof(struct tt_entry) <= (size_t)bytes) {
+        entries *= 2;
+    }
+    *wanted = entries;
+    if (!mem_fits(entries * sizeof(struct tt_entry))) {
+        /* Leave as much again for everything else */
+        while (entries > MIN_HASH_ENTRIES && !mem_fits(2 * entries * sizeof(struct tt_entry))) {
+            entries /= 2;
+        }
+        /* Much smaller and the search thrashes the table rather than finishing */
+        if (entries < *wanted / MIN_HASH_FRACTION || !mem_fits(entries * sizeof(struct tt_entry))) {
+            return 0;
+        }
+    }
+    return entries;
+}
+
+void
+tt_init(long long bytes)
+{
+    size_t wanted;
+    size_t entries = tt_entries(bytes, &wanted);
+
+    if (entries == 0) {
+        fprintf(stderr, "memory limit of %lld MB leaves too little for a useful hash table; "
+                "raise -L, lower -H, or count distinct positions with -D\n", memory_limit >> 20);
+        exit(2);
+    }
+    if (entries < wanted) {
+        fprintf(stderr, "memory limit: hash table cut to %zu entries\n", entries);
+    }
+    mem_need(MEM_CACHE, entries * sizeof(struct tt_entry));
+    tt = calloc(entries, sizeof(struct tt_entry));
+    if (tt == NULL) {
+        fprintf(stderr, "can't allocate %lld bytes for the hash table\n", bytes);
+        exit(1);
+    }
+    tt_mask = entries - 1;
+}
+
+void
+tt_free(void)
+{
+    mem_add(MEM_CACHE, -(long long)((tt_mask + 1) * sizeof(struct tt_entry)));
+    free(tt);
+}
+
+int
+tt_probe(uint64_t hash, uint64_t key, uint64_t *nodes, uint64_t *wins, struct tt_stats *stats)
+{
+    int i;
+
+    for (i = 0; i < TT_PROBES; i++) {
+        struct tt_entry *e = &tt[(hash + i) & tt_mask];
+        uint64_t k = atomic_load_explicit(&e->key, memory_order_acquire);
+
+        if (k == key) {
+            uint64_t check = atomic_load_explicit(&e->check, memory_order_acquire);
+
+            *nodes = atomic_load_explicit(&e->nodes, memory_order_relaxed);
+            *wins = atomic_load_explicit(&e->wins, memory_order_relaxed);
+            if ((key ^ *nodes ^ *wins) == check &&
+                atomic_load_explicit(&e->key, memory_order_relaxed) == key) {
+                stats->hits++;
+                return TRUE;
+            }
+            break;
+        }
+        if (k == 0) {
+            break;
+        }
+        stats->collisions++;
+    }
+    stats->misses++;
+    return FALSE;
+}
+
+/*
+ * Store into the first empty slot in the probe window, or else over the
+ * entry with the smallest subtree, which is the cheapest to recompute.
+ */
+void
+tt_store(uint64_t hash, uint64_t key, uint64_t nodes, uint64_t wins, struct tt_stats *stats)
+{
+    struct tt_entry *victim = NULL;
+    uint64_t victim_key = 0;
+    uint64_t victim_nodes = UINT64_MAX;
+    int i;
+
+    for (i = 0; i < TT_PROBES; i++) {
+        struct tt_entry *e = &tt[(hash + i) & tt_mask];
+        uint64_t k = atomic_load_explicit(&e->key, memory_order_relaxed);
+
+        if (k == key) {
+            return;
+        }
+        if (k == 0) {
+            if (atomic_compare_exchange_strong(&e->key, &k, key)) {
+                victim = e;
+                break;
+            }
+            if (k == key) {
+                return;
+            }
+        }
+        if (atomic_load_explicit(&e->nodes, memory_order_relaxed) < victim_nodes) {
+            victim_nodes = atomic_load_explicit(&e->nodes, memory_order_relaxed);
+            victim_key = k;
+            victim = e;
+        }
+    }
+    if (i == TT_PROBES) {
+        if (victim_nodes > nodes || !atomic_compare_exchange_strong(&victim->key, &victim_key, key)) {
+            return;
+        }
+        stats->replaced++;
+    }
+
+    atomic_store_explicit(&victim->check, 0, memory_order_relaxed);
+    atomic_store_explicit(&victim->nodes, nodes, memory_order_relaxed);
+    atomic_store_explicit(&victim->wins, wins, memory_order_relaxed);
+    atomic_store_explicit(&victim->check, key ^ nodes ^ wins, memory_order_release);
+}
+
+/*
+ * Parallel search.  The tree is expanded breadth first until there are
+ * plenty of subtrees to go round, then the threads take them one at a
+ * time and count each with a depth-first search that looks every
+ * position up in the shared table before expanding it.
+ */
+struct search_task {
+    bb64 pegs;
+    uint64_t hash;
+    uint64_t nodes;             /* results, for batch solving */
+    uint64_t wins;
+    int invalid;                /* for batch solving, a line that didn't parse */
+};
+
+struct search_worker {
+    pthread_t thread;
+    struct progress progress;
+    long long boards;
+    long long winning_boards;
+    long long cuts;
+    struct tt_stats stats;
+};
+
+struct search_task *tasks;
+int ntasks;
+atomic_int next_task;
+atomic_int tasks_finished;
+
+/* The workers of the search running, for the progress reporter */
+pthread_mutex_t progress_lock = PTHREAD_MUTEX_INITIALIZER;
+struct search_worker *progress_workers;
+int progress_nworkers;
+
+static inline int
+bb64_is_win(bb64 pegs)
+{
+    return bb64_popcount(pegs) == 1 &&
+           (goal_hole == 0 || !bb64_is_zero(bb64_and(pegs, bb64_hole[goal_hole - 1])));
+}
+
+/* Count the boards below a position, and the winning boards at or below it */
+static void
+tt_search(bb64 pegs, uint64_t hash, uint64_t *nodes, uint64_t *wins, struct search_worker *w)
+{
+    int moves[MAX_MOVES];
+    uint64_t key = pegs;
+    int n;
+    int i;
+
+    /* Symmetric positions have the same subtrees, so can share an entry */
+    if (symmetry) {
+        key = canonical64(pegs);
+        hash = mix64(key);
+    }
+    if (tt_probe(hash, key, nodes, wins, &w->stats)) {
+        return;
+    }
+    if (out_of_time(&w->progress, bb64_popcount(pegs))) {
+        *nodes = 0;
+        *wins = 0;
+        return;
+    }
+
+    *nodes = 0;
+    *wins = bb64_is_win(pegs);
+    n = bb64_gen_moves(pegs, moves);
+    for (i = 0; i < n; i++) {
+        bb64 child = bb64_apply(pegs, moves[i]);
+        uint64_t child_nodes;
+        uint64_t child_wins;
+
+        if (pagoda && bb64_dead(child)) {
+            w->cuts++;
+            continue;
+        }
+        tt_search(child, symmetry ? 0 : zobrist_jump(hash, &geom.moves[moves[i]]), &child_nodes, &child_wins, w);
+        *nodes += 1 + child_nodes;
+        *wins += child_wins;
+    }
+
+    /* A count cut short by the deadline is only a lower bound */
+    if (!atomic_load_explicit(&stopped, memory_order_relaxed)) {
+        tt_store(hash, key, *nodes, *wins, &w->stats);
+    }
+}
+
+static void *
+search_thread(void *arg)
+{
+    struct search_worker *w = arg;
+    int t;
+
+    while ((t = atomic_fetch_add(&next_task, 1)) < ntasks) {
+        uint64_t nodes;
+        uint64_t wins;
+
+        tt_search(tasks[t].pegs, tasks[t].hash, &nodes, &wins, w);
+        w->boards += nodes;
+        w->winning_boards += wins;
+        atomic_fetch_add_explicit(&tasks_finished, 1, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+/*
+ * Follow children with winning boards below them from the start, using
+ * the table (or recounting, if an entry has been replaced since).
+ */
+static void
+tt_winning_line(bb64 pegs, uint64_t hash, struct search_worker *w)
+{
+    int moves[MAX_MOVES];
+    int path[MAX_DEPTH];
+    int nmoves = 0;
+    int n;
+    int i;
+
+    while (!bb64_is_win(pegs)) {
+        n = bb64_gen_moves(pegs, moves);
+        for (i = 0; i < n; i++) {
+            bb64 child = bb64_apply(pegs, moves[i]);
+            uint64_t nodes;
+            uint64_t wins;
+
+            if (pagoda && bb64_dead(child)) {
+                continue;
+            }
+            tt_search(child, zobrist_jump(hash, &geom.moves[moves[i]]), &nodes, &wins, w);
+            if (wins > 0) {
+                break;
+            }
+        }
+        path[nmoves++] = moves[i];
+        hash = zobrist_jump(hash, &geom.moves[moves[i]]);
+        pegs = bb64_apply(pegs, moves[i]);
+    }
+    record_solution(path, nmoves);
+}
+
+void
+parallel_solve(int hole)
+{
+    struct search_worker *workers;
+    int moves[MAX_MOVES];
+    long long tasks_bytes = sizeof(struct search_task);
+    bb64 start;
+    int i;
+    int j;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "parallel search needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+
+    bb64_init();
+    tt_init(hash_size);
+    workers = calloc(threads, sizeof(struct search_worker));
+    mem_need(MEM_FRONTIER, tasks_bytes);
+    tasks = malloc(tasks_bytes);
+    start = bb64_xor(bb64_valid, bb64_hole[hole]);
+    tasks[0].pegs = start;
+    tasks[0].hash = bb64_hash(start);
+    ntasks = 1;
+
+    /* Split the top of the tree into subtrees, counting the boards on the way */
+    while (ntasks > 0 && ntasks < threads * TASKS_PER_THREAD) {
+        long long next_bytes = (long long)ntasks * geom.nmoves * sizeof(struct search_task);
+        struct search_task *next;
+        int nnext = 0;
+
+        mem_need(MEM_FRONTIER, next_bytes);
+        next = malloc(next_bytes);
+
+        for (i = 0; i < ntasks; i++) {
+            int n = bb64_gen_moves(tasks[i].pegs, moves);
+
+            if (bb64_is_win(tasks[i].pegs)) {
+                total_winning_boards++;
+            }
+            for (j = 0; j < n; j++) {
+                bb64 child = bb64_apply(tasks[i].pegs, moves[j]);
+
+                if (pagoda && bb64_dead(child)) {
+                    pagoda_cuts++;
+                    continue;
+                }
+                next[nnext].pegs = child;
+                next[nnext].hash = zobrist_jump(tasks[i].hash, &geom.moves[moves[j]]);
+                nnext++;
+            }
+        }
+        free(tasks);
+        mem_add(MEM_FRONTIER, -tasks_bytes);
+        tasks = next;
+        tasks_bytes = next_bytes;
+        ntasks = nnext;
+        total_boards += nnext;
+    }
+
+    atomic_store(&next_task, 0);
+    atomic_store(&tasks_finished, 0);
+    pthread_mutex_lock(&progress_lock);
+    progress_workers = workers;
+    progress_nworkers = threads;
+    pthread_mutex_unlock(&progress_lock);
+    for (i = 0; i < threads; i++) {
+        pthread_create(&workers[i].thread, NULL, search_thread, &workers[i]);
+    }
+    for (i = 0; i < threads; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    pthread_mutex_lock(&progress_lock);
+    progress_nworkers = 0;
+    pthread_mutex_unlock(&progress_lock);
+    for (i = 0; i < threads; i++) {
+        total_boards += workers[i].boards;
+        total_winning_boards += workers[i].winning_boards;
+        pagoda_cuts += workers[i].cuts;
+        tt_totals.hits += workers[i].stats.hits;
+        tt_totals.misses += workers[i].stats.misses;
+        tt_totals.collisions += workers[i].stats.collisions;
+        tt_totals.replaced += workers[i].stats.replaced;
+    }
+
+    if (total_winning_boards > 0 && !atomic_load(&stopped)) {
+        tt_winning_line(start, bb64_hash(start), &workers[0]);
+    }
+
+    free(tasks);
+    mem_add(MEM_FRONTIER, -tasks_bytes);
+    free(workers);
+    tt_free();
+}
+
+/*
+ * Progress reporting.  While a search runs, a thread of its own wakes
+ * every PROGRESS_TICK seconds and reads what the search threads have
+ * published (see struct progress and progress_layer()): with -u it prints
+ * a line every so many seconds of nodes per second, how much is done with
+ * an estimate of the time left, and the peg counts the search was sampled
+ * at since the last line; on SIGUSR1 it prints everything it knows.  It
+ * only reads, so the search threads never wait for it.
+ */
+#define PROGRESS_TICK 0.1                   /* seconds between looks for SIGUSR1 */
+
+struct progress_snapshot {
+    double t;
+    long long nodes;
+    long long samples[MAX_HOLES + 1];
+    double done;
+};
+
+double report_interval = 0;                 /* seconds, or 0 for no reports */
+atomic_int dump_requested;
+atomic_int reporter_quit;
+pthread_t reporter;
+pthread_mutex_t reporter_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t reporter_wake = PTHREAD_COND_INITIALIZER;
+
+void
+request_dump(int sig)
+{
+    (void)sig;
+    atomic_store(&dump_requested, 1);
+}
+
+static void
+progress_add(struct progress_snapshot *snap, struct progress *p)
+{
+    int k;
+
+    snap->nodes += atomic_load_explicit(&p->nodes, memory_order_relaxed);
+    for (k = 0; k <= geom.holes; k++) {
+        snap->samples[k] += atomic_load_explicit(&p->samples[k], memory_order_relaxed);
+    }
+}
+
+static void
+progress_gather(struct progress_snapshot *snap)
+{
+    int i;
+
+    memset(snap, 0, sizeof(*snap));
+    snap->t = now();
+    pthread_mutex_lock(&progress_lock);
+    progress_add(snap, &main_progress);
+    snap->done = atomic_load_explicit(&main_progress.done, memory_order_relaxed);
+    for (i = 0; i < progress_nworkers; i++) {
+        progress_add(snap, &progress_workers[i].progress);
+    }
+    if (progress_nworkers > 0 && !batch) {
+        snap->done = (double)atomic_load(&tasks_finished) / ntasks;
+    }
+    pthread_mutex_unlock(&progress_lock);
+}
+
+static void
+print_eta(struct progress_snapshot *snap)
+{
+    double elapsed = snap->t - search_start;
+
+    if (snap->done > 0) {
+        fprintf(stderr, ", %.2f%% done, ETA %.0fs", 100 * snap->done, elapsed * (1 - snap->done) / snap->done);
+    } else if (snap->done == 0) {
+        fprintf(stderr, ", 0.00%% done");
+    }
+}
+
+/* A line of progress, with the rate and the peg counts since the last one */
+static void
+print_progress(struct progress_snapshot *snap, struct progress_snapshot *last)
+{
+    long long total = 0;
+    int k;
+
+    fprintf(stderr, "[%8.1fs] %lld nodes, %.0f nodes/s", snap->t - search_start, snap->nodes,
+            snap->t > last->t ? (snap->nodes - last->nodes) / (snap->t - last->t) : 0);
+    print_eta(snap);
+    for (k = 0; k <= geom.holes; k++) {
+        total += snap->samples[k] - last->samples[k];
+    }
+    if (total > 0) {
+        fprintf(stderr, "; pegs");
+        for (k = geom.holes; k >= 0; k--) {
+            double share = 100.0 * (snap->samples[k] - last->samples[k]) / total;
+
+            if (share >= 0.5) {
+                fprintf(stderr, " %d:%.0f%%", k, share);
+            }
+        }
+    }
+    fprintf(stderr, "\n");
+}
+
+/* Everything, for SIGUSR1 */
+static void
+print_snapshot(struct progress_snapshot *snap)
+{
+    double elapsed = snap->t - search_start;
+    long long total = 0;
+    int i;
+    int k;
+
+    fprintf(stderr, "Search after %.2fs: %lld nodes, %.0f nodes/s", elapsed, snap->nodes,
+            elapsed > 0 ? snap->nodes / elapsed : 0);
+    print_eta(snap);
+    fprintf(stderr, "\n");
+    pthread_mutex_lock(&progress_lock);
+    for (i = 0; i < progress_nworkers; i++) {
+        fprintf(stderr, "  thread %d: %lld nodes\n", i + 1,
+                atomic_load_explicit(&progress_workers[i].progress.nodes, memory_order_relaxed));
+    }
+    if (progress_nworkers > 0 && batch) {
+        fprintf(stderr, "  positions: %d solved\n", atomic_load(&tasks_finished));
+    } else if (progress_nworkers > 0) {
+        fprintf(stderr, "  tasks: %d of %d finished\n", atomic_load(&tasks_finished), ntasks);
+    }
+    pthread_mutex_unlock(&progress_lock);
+    for (k = 0; k <= geom.holes; k++) {
+        total += snap->samples[k];
+    }
+    for (k = geom.holes; k >= 0; k--) {
+        if (snap->samples[k] > 0) {
+            fprintf(stderr, "  %2d pegs: %10lld samples (%.1f%%)\n", k, snap->samples[k],
+                    100.0 * snap->samples[k] / total);
+        }
+    }
+    if (best_pegs <= geom.holes) {
+        fprintf(stderr, "  fewest pegs left so far: %d\n", best_pegs);
+    }
+    fprintf(stderr, "  peak RSS: %.1f MB\n", peak_rss() / 1048576.0);
+}
+
+static void *
+reporter_thread(void *arg)
+{
+    struct progress_snapshot last;
+    struct progress_snapshot snap;
+    double next_report = search_start + report_interval;
+
+    (void)arg;
+    progress_gather(&last);
+    last.t = search_start;
+    memset(last.samples, 0, sizeof(last.samples));
+    last.nodes = 0;
+    while (!atomic_load(&reporter_quit)) {
+        struct timespec until;
+
+        /* Wait a tick, or less if progress_stop() wakes us */
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_nsec += (long)(PROGRESS_TICK * 1e9);
+        if (until.tv_nsec >= 1000000000) {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000;
+        }
+        pthread_mutex_lock(&reporter_lock);
+        if (!atomic_load(&reporter_quit)) {
+            pthread_cond_timedwait(&reporter_wake, &reporter_lock, &until);
+        }
+        pthread_mutex_unlock(&reporter_lock);
+        if (atomic_exchange(&dump_requested, 0)) {
+            progress_gather(&snap);
+            print_snapshot(&snap);
+        }
+        if (report_interval > 0 && now() >= next_report) {
+            progress_gather(&snap);
+            print_progress(&snap, &last);
+            last = snap;
+            next_report += report_interval;
+        }
+    }
+    return NULL;
+}
+
+void
+progress_start(void)
+{
+    int k;
+
+    main_progress.ticks = 0;
+    atomic_store(&main_progress.nodes, 0);
+    for (k = 0; k <= MAX_HOLES; k++) {
+        atomic_store(&main_progress.samples[k], 0);
+    }
+    atomic_store(&main_progress.done, -1.0);
+    atomic_store(&reporter_quit, 0);
+    signal(SIGUSR1, request_dump);
+    pthread_create(&reporter, NULL, reporter_thread, NULL);
+}
+
+void
+progress_stop(void)
+{
+    pthread_mutex_lock(&reporter_lock);
+    atomic_store(&reporter_quit, 1);
+    pthread_cond_signal(&reporter_wake);
+    pthread_mutex_unlock(&reporter_lock);
+    pthread_join(reporter, NULL);
+    signal(SIGUSR1, SIG_IGN);
+}
+
+/*
+ * Batch solving: positions are read from stdin, one per line, either as
+ * a string of holes in reading order ('X' or '1' for a peg, '.' or '0' for
+ * empty; spaces are ignored) or as 0x followed by the holes as a hex
+ * number, hole 1 being bit 0.  Each gets a line on stdout, in the same
+ * order, of the position in hex, the boards from it onwards and the
+ * winning boards among them, or "invalid".  Blocks of positions are
+ * shared among the threads, and the hash table is kept for the whole run
+ * so later positions can use what earlier ones found.
+ */
+/*
+ * Read a line of input into line, which holds size bytes.  A line too
+ * long for it is read to its end and comes back empty, so it still counts
+ * as one line, and one that doesn't parse.  Returns FALSE at the end of
+ * the input.
+ */
+static int
+read_line(char *line, int size, FILE *fp)
+{
+    size_t len;
+    int c;
+
+    if (fgets(line, size, fp) == NULL) {
+        return FALSE;
+    }
+    len = strlen(line);
+    if (len > 0 && line[len - 1] != '\n' && (c = getc(fp)) != EOF && c != '\n') {
+        while ((c = getc(fp)) != EOF && c != '\n') {
+            ;
+        }
+        line[0] = '\0';
+    }
+    return TRUE;
+}
+
+int
+parse_position(const char *line, bb64 *pegs)
+{
+    int h = 0;
+
+    *pegs = 0;
+    if (line[0] == '0' && (line[1] == 'x' || line[1] == 'X')) {
+        char *end;
+        unsigned long long holes = strtoull(line + 2, &end, 16);
+
+        while (*end == ' ' || *end == '\t' || *end == '\r' || *end == '\n') {
+            end++;
+        }
+        if (end == line + 2 || *end != '\0' || (geom.holes < 64 && holes >> geom.holes != 0)) {
+            return FALSE;
+        }
+        for (h = 0; h < geom.holes; h++) {
+            if (holes & (1ULL << h)) {
+                *pegs |= bb64_hole[h];
+            }
+        }
+        return TRUE;
+    }
+
+    for (; *line != '\0'; line++) {
+        if (*line == ' ' || *line == '\t' || *line == '\r' || *line == '\n') {
+            continue;
+        }
+        if (h == geom.holes) {
+            return FALSE;
+        }
+        if (*line == 'X' || *line == '1') {
+            *pegs |= bb64_hole[h];
+        } else if (*line != '.' && *line != '0') {
+            return FALSE;
+        }
+        h++;
+    }
+    return h == geom.holes;
+}
+
+static void *
+batch_thread(void *arg)
+{
+    struct search_worker *w = arg;
+    int t;
+
+    while ((t = atomic_fetch_add(&next_task, 1)) < ntasks) {
+        if (tasks[t].pegs != 0) {
+            tt_search(tasks[t].pegs, tasks[t].hash, &tasks[t].nodes, &tasks[t].wins, w);
+        }
+        atomic_fetch_add_explicit(&tasks_finished, 1, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+void
+batch_solve(void)
+{
+    struct search_worker *workers;
+    char line[BATCH_LINE_LEN];
+    long long positions = 0;
+    int eof = FALSE;
+    double t;
+    int i;
+    int h;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "batch solving needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+
+    bb64_init();
+    tt_init(hash_size);
+    workers = calloc(threads, sizeof(struct search_worker));
+    mem_need(MEM_FRONTIER, BATCH_BLOCK * sizeof(struct search_task));
+    tasks = malloc(BATCH_BLOCK * sizeof(struct search_task));
+    t = now();
+    /* How many positions are coming isn't known, so tasks_finished just counts them */
+    atomic_store(&tasks_finished, 0);
+    pthread_mutex_lock(&progress_lock);
+    progress_workers = workers;
+    progress_nworkers = threads;
+    pthread_mutex_unlock(&progress_lock);
+
+    while (!eof) {
+        /* An empty board has nothing to search, but is still a board */
+        for (ntasks = 0; ntasks < BATCH_BLOCK; ntasks++) {
+            struct search_task *task = &tasks[ntasks];
+
+            if (!read_line(line, sizeof(line), stdin)) {
+                eof = TRUE;
+                break;
+            }
+            memset(task, 0, sizeof(*task));
+            if (!parse_position(line, &task->pegs)) {
+                task->pegs = 0;
+                task->invalid = TRUE;
+            } else if (task->pegs != 0) {
+                task->hash = bb64_hash(task->pegs);
+            }
+        }
+
+        atomic_store(&next_task, 0);
+        for (i = 0; i < threads; i++) {
+            pthread_create(&workers[i].thread, NULL, batch_thread, &workers[i]);
+        }
+        for (i = 0; i < threads; i++) {
+            pthread_join(workers[i].thread, NULL);
+        }
+
+        for (i = 0; i < ntasks; i++) {
+            unsigned long long holes = 0;
+
+            for (h = 0; h < geom.holes; h++) {
+                if (tasks[i].pegs & bb64_hole[h]) {
+                    holes |= 1ULL << h;
+                }
+            }
+            if (output_format != OUTPUT_TEXT) {
+                output_result(0, holes, tasks[i].invalid ? 0 : tasks[i].nodes + 1, tasks[i].wins, -1,
+                              tasks[i].invalid ? RECORD_INVALID : 0, 0);
+            } else if (tasks[i].invalid) {
+                sink_printf(&out, "invalid\n");
+            } else {
+                sink_printf(&out, "0x%llx %llu %llu\n", holes, (unsigned long long)tasks[i].nodes + 1,
+                            (unsigned long long)tasks[i].wins);
+            }
+        }
+        positions += ntasks;
+    }
+    pthread_mutex_lock(&progress_lock);
+    progress_nworkers = 0;
+    pthread_mutex_unlock(&progress_lock);
+
+    t = now() - t;
+    for (i = 0; i < threads; i++) {
+        tt_totals.hits += workers[i].stats.hits;
+        tt_totals.misses += workers[i].stats.misses;
+        tt_totals.collisions += workers[i].stats.collisions;
+        tt_totals.replaced += workers[i].stats.replaced;
+    }
+    if (output_format == OUTPUT_JSON) {
+        sink_printf(&out, "{\"type\":\"summary\",\"positions\":%lld,\"seconds\":%.6f,\"peak_bytes\":%lld,\"peak_rss\":%lld}\n",
+                    positions, t, mem_total_peak, peak_rss());
+    }
+    sink_flush(&out);
+    fprintf(stderr, "%lld positions in %.3fs (%.0f positions/s), %lld hits, %lld misses\n", positions, t,
+            t > 0 ? positions / t : 0, tt_totals.hits, tt_totals.misses);
+
+    free(tasks);
+    mem_add(MEM_FRONTIER, -(long long)(BATCH_BLOCK * sizeof(struct search_task)));
+    free(workers);
+    tt_free();
+}
+
+/*
+ * Winnability of every position on the standard board, as a bit per
+ * position numbered with hole h as bit h - 1.  The table is worked out
+ * here and written out as winnable15.h by -W, which is built in, so on
+ * the standard board -f and the hints in -a need no search at all.
+ * Positions are done in order of peg count, as a jump only ever leads to
+ * a position with one peg fewer.
+ */
+void
+winnable_compute(unsigned char *table)
+{
+    uint32_t npositions = (uint32_t)1 << geom.holes;
+    uint32_t p;
+    int count;
+    int i;
+
+    memset(table, 0, npositions / 8);
+    for (count = 1; count <= geom.holes; count++) {
+        for (p = 1; p < npositions; p++) {
+            if (__builtin_popcount(p) != count) {
+                continue;
+            }
+            if (count == 1) {
+                table[p / 8] |= 1 << (p % 8);
+                continue;
+            }
+            for (i = 0; i < geom.nmoves; i++) {
+                const struct move *m = &geom.moves[i];
+                uint32_t child;
+
+                if (!(p >> m->from & 1) || !(p >> m->over & 1) || (p >> m->to & 1)) {
+                    continue;
+                }
+                child = p ^ (1u << m->from) ^ (1u << m->over) ^ (1u << m->to);
+                if (table[child / 8] >> (child % 8) & 1) {
+                    table[p / 8] |= 1 << (p % 8);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void
+write_winnable_header(void)
+{
+    unsigned char table[WINNABLE15_BYTES];
+    int i;
+
+    init_geometry(WINNABLE15_SIDE);
+    winnable_compute(table);
+    printf("/*\n"
+           " * Generated by \"tri_solitaire -W > winnable15.h\"; do not edit.\n"
+           " *\n"
+           " * Bit p %% 8 of byte p / 8 is set if position p of the 15-hole board,\n"
+           " * with hole h as bit h - 1, can be cut down to a single peg.\n"
+           " */\n"
+           "#define WINNABLE15_SIDE  %d\n"
+           "#define WINNABLE15_BYTES %d\n"
+           "\n"
+           "static const unsigned char winnable15[WINNABLE15_BYTES] = {\n", WINNABLE15_SIDE, WINNABLE15_BYTES);
+    for (i = 0; i < WINNABLE15_BYTES; i++) {
+        printf("%s0x%02x,%s", i % 16 == 0 ? "    " : " ", table[i], i % 16 == 15 ? "\n" : "");
+    }
+    printf("};\n");
+}
+
+/* Whether a position on the standard board (as a bitboard) can be won */
+int
+winnable(bb64 pegs)
+{
+    uint32_t p = 0;
+    int h;
+
+    for (h = 0; h < geom.holes; h++) {
+        if (!bb64_is_zero(bb64_and(pegs, bb64_hole[h]))) {
+            p |= 1u << h;
+        }
+    }
+    return winnable15[p / 8] >> (p % 8) & 1;
+}
+
+/* Whether the built-in table answers for this board */
+int
+use_winnable_table(void)
+{
+    return geom.side == WINNABLE15_SIDE && goal_hole == 0 && !pagoda;
+}
+
+/*
+ * A winning line straight from the table: from each position, take the
+ * first move to a position that can still be won.  Nothing is searched,
+ * so the lookups are counted on their own rather than as boards.
+ */
+long long table_lookups = 0;
+
+void
+table_solution(int hole)
+{
+    int moves[MAX_MOVES];
+    int path[MAX_DEPTH];
+    bb64 pegs;
+    int nmoves = 0;
+    int n;
+    int i;
+
+    bb64_init();
+    pegs = bb64_xor(bb64_valid, bb64_hole[hole]);
+    table_lookups++;
+    if (!winnable(pegs)) {
+        return;
+    }
+    while (bb64_popcount(pegs) > 1) {
+        n = bb64_gen_moves(pegs, moves);
+        for (i = 0; i < n; i++) {
+            table_lookups++;
+            if (winnable(bb64_apply(pegs, moves[i]))) {
+                break;
+            }
+        }
+        path[nmoves++] = moves[i];
+        pegs = bb64_apply(pegs, moves[i]);
+    }
+    total_winning_boards = 1;
+    record_solution(path, nmoves);
+}
+
+/*
+ * Interactive play.  Every position reachable from the start is counted
+ * once up front, the way -j does, and kept in the hash table, so after
+ * each move the number of winning lines from each choice is a table
+ * lookup.  On the standard board, whether a position can be won and the
+ * hints come from the built-in table instead.  Moves are typed as "from
+ * to" (or "from-to"), with u to take the last one back, h for a hint and
+ * q to give up.
+ */
+void
+play_game(int hole)
+{
+    struct search_worker w;
+    bb64 history[MAX_DEPTH + 1];
+    uint64_t hashes[MAX_DEPTH + 1];
+    unsigned char holes[MAX_HOLES];
+    char line[BATCH_LINE_LEN];
+    int moves[MAX_MOVES];
+    uint64_t move_wins[MAX_MOVES];
+    uint64_t nodes;
+    uint64_t wins;
+    int nplayed = 0;
+    int last = -1;
+    double t;
+    int h;
+    int n;
+    int i;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "play needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+
+    bb64_init();
+    tt_init(hash_size);
+    memset(&w, 0, sizeof(w));
+    history[0] = bb64_xor(bb64_valid, bb64_hole[hole]);
+    hashes[0] = bb64_hash(history[0]);
+    t = now();
+    tt_search(history[0], hashes[0], &nodes, &wins, &w);
+    printf("Counted %llu boards from the start in %.3fs; %llu of them are wins\n",
+           (unsigned long long)nodes + 1, now() - t, (unsigned long long)wins);
+
+    for (;;) {
+        bb64 pegs = history[nplayed];
+        uint64_t best = 0;
+        int pick = -1;
+
+        for (h = 0; h < geom.holes; h++) {
+            holes[h] = !bb64_is_zero(bb64_and(pegs, bb64_hole[h]));
+        }
+        print_holes(holes, last);
+
+        t = now();
+        tt_search(pegs, hashes[nplayed], &nodes, &wins, &w);
+        n = bb64_gen_moves(pegs, moves);
+        for (i = 0; i < n; i++) {
+            const struct move *m = &geom.moves[moves[i]];
+
+            tt_search(bb64_apply(pegs, moves[i]), zobrist_jump(hashes[nplayed], m), &nodes, &move_wins[i], &w);
+        }
+        t = now() - t;
+
+        if (n == 0) {
+            if (bb64_is_win(pegs)) {
+                printf("Solved!\n");
+            } else {
+                printf("No moves left, with %d pegs on the board.\n", bb64_popcount(pegs));
+            }
+            break;
+        }
+        if (use_winnable_table() ? winnable(pegs) : wins > 0) {
+            printf("Still winnable: %llu winning lines from here.\n", (unsigned long long)wins);
+        } else {
+            printf("Not winnable any more.\n");
+        }
+        for (i = 0; i < n; i++) {
+            const struct move *m = &geom.moves[moves[i]];
+
+            printf("  %2d-%-2d  %llu\n", m->from + 1, m->to + 1, (unsigned long long)move_wins[i]);
+            if (use_winnable_table()) {
+                if (pick < 0 && winnable(bb64_apply(pegs, moves[i]))) {
+                    pick = i;
+                }
+            } else if (pick < 0 || move_wins[i] > best) {
+                best = move_wins[i];
+                pick = i;
+            }
+        }
+        printf("(looked up in %.1f us)\n", 1e6 * t);
+
+        for (;;) {
+            int from;
+            int to;
+
+            printf("move> ");
+            fflush(stdout);
+            if (!read_line(line, sizeof(line), stdin) || line[0] == 'q') {
+                printf("\n");
+                tt_free();
+                return;
+            }
+            if (line[0] == 'u') {
+                if (nplayed == 0) {
+                    printf("Nothing to take back.\n");
+                    continue;
+                }
+                nplayed--;
+                last = -1;
+                break;
+            }
+            if (line[0] == 'h') {
+                if (pick < 0) {
+                    printf("Nothing wins from here.\n");
+                } else {
+                    printf("Try %d-%d.\n", geom.moves[moves[pick]].from + 1, geom.moves[moves[pick]].to + 1);
+                }
+                continue;
+            }
+            if (sscanf(line, "%d%*[ -]%d", &from, &to) != 2) {
+                printf("Type a move as \"from to\", or u, h or q.\n");
+                continue;
+            }
+            for (i = 0; i < n; i++) {
+                if (geom.moves[moves[i]].from == from - 1 && geom.moves[moves[i]].to == to - 1) {
+                    break;
+                }
+            }
+            if (i == n) {
+                printf("%d-%d isn't a legal move.\n", from, to);
+                continue;
+            }
+            history[nplayed + 1] = bb64_apply(pegs, moves[i]);
+            hashes[nplayed + 1] = zobrist_jump(hashes[nplayed], &geom.moves[moves[i]]);
+            nplayed++;
+            last = to - 1;
+            break;
+        }
+    }
+    tt_free();
+}
+
+/*
+ * Monte Carlo playouts, split evenly across the threads.  Each thread has
+ * its own generator and tallies, so nothing is shared until the end.
+ */
+struct playout_job {
+    struct playout_worker *worker;
+    int hole;
+    long long games;
+};
+
+static void *
+playout_thread(void *arg)
+{
+    struct playout_job *job = arg;
+
+    if (geom.side * geom.side <= 64) {
+        bb64_playouts(job->hole, job->games, job->worker);
+    } else if (geom.side * geom.side <= 128) {
+        bb128_playouts(job->hole, job->games, job->worker);
+    } else {
+        bbp256_playouts(job->hole, job->games, job->worker);
+    }
+    return NULL;
+}
+
+void
+monte_carlo(int hole)
+{
+    int nthreads = (threads > 0 ? threads : 1);
+    struct playout_worker *workers = calloc(nthreads, sizeof(struct playout_worker));
+    struct playout_job *jobs = calloc(nthreads, sizeof(struct playout_job));
+    long long pegs_left[MAX_HOLES + 1];
+    long long wins = 0;
+    double z = 1.96;
+    double t;
+    double p;
+    double centre;
+    double spread;
+    int i;
+    int k;
+
+    if (geom.side * geom.side <= 64) {
+        bb64_init();
+    } else if (geom.side * geom.side <= 128) {
+        bb128_init();
+    } else {
+        bbp256_init();
+    }
+
+    t = now();
+    for (i = 0; i < nthreads; i++) {
+        workers[i].rng = 0x6d6f6e7465ULL + i * 0x9e3779b97f4a7c15ULL;
+        jobs[i].worker = &workers[i];
+        jobs[i].hole = hole;
+        jobs[i].games = playouts / nthreads + (i < playouts % nthreads);
+        pthread_create(&workers[i].thread, NULL, playout_thread, &jobs[i]);
+    }
+    memset(pegs_left, 0, sizeof(pegs_left));
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(workers[i].thread, NULL);
+        wins += workers[i].wins;
+        for (k = 0; k <= geom.holes; k++) {
+            pegs_left[k] += workers[i].pegs_left[k];
+        }
+    }
+    t = now() - t;
+
+    /* Wilson score interval for the chance of winning */
+    p = (double)wins / playouts;
+    centre = (p + z * z / (2 * playouts)) / (1 + z * z / playouts);
+    spread = z * sqrt(p * (1 - p) / playouts + z * z / (4.0 * playouts * playouts)) / (1 + z * z / playouts);
+
+    printf("Playouts: %lld in %.3fs (%.0f games/s)\n", playouts, t, t > 0 ? playouts / t : 0);
+    printf("Winning: %lld (%.4f%%, 95%% confidence %.4f%% to %.4f%%)\n",
+           wins, 100 * p, 100 * (centre - spread), 100 * (centre + spread));
+    for (k = 1; k <= geom.holes; k++) {
+        if (pegs_left[k] > 0) {
+            printf("%2d peg%s left: %12lld (%.4f%%)\n", k, k == 1 ? " " : "s", pegs_left[k],
+                   100.0 * pegs_left[k] / playouts);
+        }
+    }
+    for (i = 0; i < nthreads; i++) {
+        printf("Thread %d: %lld games, %lld wins\n", i, workers[i].games, workers[i].wins);
+    }
+
+    free(jobs);
+    free(workers);
+}
+
+/*
+ * External-memory breadth-first search over distinct positions.
+ *
+ * Every move removes a peg, so the positions fall into layers by peg count
+ * and each layer only feeds the next.  A layer lives on disk as a sorted
+ * file of unique 64-bit bitboards.  Expanding it streams the file through
+ * the move generator into a buffer the size of the memory budget; each
+ * time the buffer fills it is sorted, deduplicated and spilled as a run,
+ * and the runs are then merged (MERGE_FANIN at a time) into the next
+ * layer's file, dropping duplicates as they go by.
+ */
+struct run_reader {
+    FILE *fp;
+    uint64_t head;
+};
+
+static int
+compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static size_t
+sort_unique(uint64_t *v, size_t n)
+{
+    size_t i;
+    size_t out = 0;
+
+    qsort(v, n, sizeof(uint64_t), compare_u64);
+    for (i = 0; i < n; i++) {
+        if (out == 0 || v[out - 1] != v[i]) {
+            v[out++] = v[i];
+        }
+    }
+    return out;
+}
+
+static void
+spill_name(char *buf, int pegs, int pass, int run)
+{
+    snprintf(buf, SPILL_NAME_LEN, "%s/tri_solitaire.%d.%02d.%d.%d",
+             spill_dir, (int)getpid(), pegs, pass, run);
+}
+
+static FILE *
+spill_open(const char *path, const char *mode)
+{
+    FILE *fp = fopen(path, mode);
+
+    if (fp == NULL) {
+        perror(path);
+        exit(1);
+    }
+    return fp;
+}
+
+static void
+spill_close(FILE *fp, const char *path)
+{
+    if (ferror(fp) || fclose(fp) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+static int
+run_next(struct run_reader *r)
+{
+    return fread(&r->head, sizeof(r->head), 1, r->fp) == 1;
+}
+
+static void
+run_sift_down(struct run_reader *readers, int *heap, int n, int i)
+{
+    for (;;) {
+        int child = 2 * i + 1;
+        int tmp;
+
+        if (child >= n) {
+            return;
+        }
+        if (child + 1 < n && readers[heap[child + 1]].head < readers[heap[child]].head) {
+            child++;
+        }
+        if (readers[heap[i]].head <= readers[heap[child]].head) {
+            return;
+        }
+        tmp = heap[i];
+        heap[i] = heap[child];
+        heap[child] = tmp;
+        i = child;
+    }
+}
+
+/*
+ * Merge sorted runs into one, dropping duplicates, and delete the inputs.
+ * The runs are kept in a heap ordered by the next value in each.
+ */
+static long long
+merge_runs(char names[][SPILL_NAME_LEN], int n, const char *output)
+{
+    struct run_reader readers[MERGE_FANIN];
+    int heap[MERGE_FANIN];
+    int nheap = 0;
+    uint64_t last = 0;
+    long long count = 0;
+    FILE *out = spill_open(output, "wb");
+    int i;
+
+    for (i = 0; i < n; i++) {
+        readers[i].fp = spill_open(names[i], "rb");
+        if (run_next(&readers[i])) {
+            heap[nheap++] = i;
+        }
+    }
+    for (i = nheap / 2 - 1; i >= 0; i--) {
+        run_sift_down(readers, heap, nheap, i);
+    }
+
+    while (nheap > 0) {
+        struct run_reader *top = &readers[heap[0]];
+
+        if (count == 0 || top->head != last) {
+            last = top->head;
+            fwrite(&last, sizeof(last), 1, out);
+            count++;
+        }
+        if (!run_next(top)) {
+            heap[0] = heap[--nheap];
+        }
+        run_sift_down(readers, heap, nheap, 0);
+    }
+
+    for (i = 0; i < n; i++) {
+        fclose(readers[i].fp);
+        unlink(names[i]);
+    }
+    spill_close(out, output);
+    return count;
+}
+
+/*
+ * Checkpoints.  With -c the breadth-first searches (-x, -D and -R) save
+ * their state in the -T directory each time they finish a layer, and -r
+ * carries on from the last one saved.  The state is a small text file of
+ * counters, named for the search, the board and the holes, plus the
+ * layers the search still needs: -x's merged layer file where it already
+ * is, and the bit arrays of -D and -R in files of their own.  Everything
+ * is written under a temporary name and renamed into place, so a crash
+ * part way through leaves the previous checkpoint whole.
+ */
+#define CHECKPOINT_VERSION 1
+
+struct checkpoint {
+    int pegs;                               /* in the last layer finished */
+    long long in_layer;
+    long long distinct;
+    long long winning;
+    long long states;
+    char layer[SPILL_NAME_LEN];             /* -x's layer file */
+};
+
+/* The checkpoint file itself for pegs < 0, else a saved layer */
+static void
+checkpoint_name(char *buf, const char *search, int hole, int pegs)
+{
+    if (pegs < 0) {
+        snprintf(buf, SPILL_NAME_LEN, "%s/tri_solitaire.%s.s%d.e%d.g%d.ckpt",
+                 spill_dir, search, geom.side, hole + 1, goal_hole);
+    } else {
+        snprintf(buf, SPILL_NAME_LEN, "%s/tri_solitaire.%s.s%d.e%d.g%d.%02d.bits",
+                 spill_dir, search, geom.side, hole + 1, goal_hole, pegs);
+    }
+}
+
+/* Finish writing fp as tmp and move it over path */
+static void
+checkpoint_commit(FILE *fp, const char *tmp, const char *path)
+{
+    if (fflush(fp) != 0 || fsync(fileno(fp)) != 0) {
+        perror(tmp);
+        exit(1);
+    }
+    spill_close(fp, tmp);
+    if (rename(tmp, path) != 0) {
+        perror(path);
+        exit(1);
+    }
+}
+
+/* Get a file written and closed some other way onto the disk */
+static void
+checkpoint_sync(const char *path)
+{
+    FILE *fp = spill_open(path, "rb");
+
+    if (fsync(fileno(fp)) != 0) {
+        perror(path);
+        exit(1);
+    }
+    fclose(fp);
+}
+
+static void
+checkpoint_save(const char *search, int hole, const struct checkpoint *ck)
+{
+    char path[SPILL_NAME_LEN];
+    char tmp[SPILL_NAME_LEN + 4];
+    FILE *fp;
+
+    checkpoint_name(path, search, hole, -1);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    fp = spill_open(tmp, "w");
+    fprintf(fp, "tri_solitaire checkpoint %d\n", CHECKPOINT_VERSION);
+    fprintf(fp, "pegs %d\nin_layer %lld\ndistinct %lld\nwinning %lld\nstates %lld\nlayer %s\n",
+            ck->pegs, ck->in_layer, ck->distinct, ck->winning, ck->states, ck->layer);
+    checkpoint_commit(fp, tmp, path);
+}
+
+/* Read the checkpoint to carry on from with -r; FALSE to start afresh */
+static int
+checkpoint_load(const char *search, int hole, struct checkpoint *ck)
+{
+    char path[SPILL_NAME_LEN];
+    int version = 0;
+    size_t len;
+    FILE *fp;
+
+    if (!resume) {
+        return FALSE;
+    }
+    checkpoint_name(path, search, hole, -1);
+    fp = fopen(path, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "no checkpoint %s, starting from the beginning\n", path);
+        return FALSE;
+    }
+    memset(ck, 0, sizeof(*ck));
+    if (fscanf(fp, "tri_solitaire checkpoint %d pegs %d in_layer %lld distinct %lld winning %lld states %lld layer ",
+               &version, &ck->pegs, &ck->in_layer, &ck->distinct, &ck->winning, &ck->states) != 6 ||
+        version != CHECKPOINT_VERSION) {
+        fprintf(stderr, "%s: not a checkpoint this program can resume from\n", path);
+        exit(1);
+    }
+    /* Only -x has a layer file */
+    if (fgets(ck->layer, sizeof(ck->layer), fp) == NULL) {
+        ck->layer[0] = '\0';
+    }
+    fclose(fp);
+    len = strlen(ck->layer);
+    if (len > 0 && ck->layer[len - 1] == '\n') {
+        ck->layer[len - 1] = '\0';
+    }
+    if (!check) {
+        fprintf(stderr, "resuming from %s at %d pegs\n", path, ck->pegs);
+    }
+    return TRUE;
+}
+
+static void
+layer_remove(const char *search, int hole, int pegs)
+{
+    char path[SPILL_NAME_LEN];
+
+    checkpoint_name(path, search, hole, pegs);
+    unlink(path);
+}
+
+/* Remove the checkpoint, and its saved layers from pegs lo to hi */
+static void
+checkpoint_remove(const char *search, int hole, int lo, int hi)
+{
+    for (; lo <= hi; lo++) {
+        layer_remove(search, hole, lo);
+    }
+    layer_remove(search, hole, -1);
+}
+
+static void
+layer_save(const char *search, int hole, int pegs, const void *bits, size_t bytes)
+{
+    char path[SPILL_NAME_LEN];
+    char tmp[SPILL_NAME_LEN + 4];
+    FILE *fp;
+
+    checkpoint_name(path, search, hole, pegs);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    fp = spill_open(tmp, "wb");
+    fwrite(bits, 1, bytes, fp);
+    checkpoint_commit(fp, tmp, path);
+}
+
+static void
+layer_load(const char *search, int hole, int pegs, void *bits, size_t bytes)
+{
+    char path[SPILL_NAME_LEN];
+    FILE *fp;
+
+    checkpoint_name(path, search, hole, pegs);
+    fp = spill_open(path, "rb");
+    if (fread(bits, 1, bytes, fp) != bytes) {
+        fprintf(stderr, "%s: layer is short\n", path);
+        exit(1);
+    }
+    fclose(fp);
+}
+
+/* Whether a breadth-first search should stop after the layer it just finished */
+static int
+layer_stop(void)
+{
+    if (deadline > 0 && now() >= deadline) {
+        atomic_store(&stopped, 1);
+    }
+    return atomic_load(&stopped);
+}
+
+#define LAYER_PROGRESS 65536                /* positions between reports; a power of 2 */
+
+/*
+ * How far a search that goes a layer at a time has got, as a fraction: it
+ * is through that much of the layer with pegs pegs and has done the layers
+ * above it (down) or below it.  Layers are weighted by C(holes, pegs), the
+ * positions they could hold, which is rough but known up front.
+ */
+static double
+layers_done(int pegs, int down, double through)
+{
+    double size = 1;
+    double total = 0;
+    double done = 0;
+    int k;
+
+    for (k = 1; k < geom.holes; k++) {
+        size = size * (geom.holes - k + 1) / k;
+        total += size;
+        if (k == pegs) {
+            done += through * size;
+        } else if (down ? k > pegs : k < pegs) {
+            done += size;
+        }
+    }
+    return done / total;
+}
+
+/*
+ * Tell the reporter a layered search has worked on positions more
+ * positions, in the layer with pegs pegs, and how much of it is done if
+ * that is known (done >= 0).  Only the thread running the search calls it.
+ */
+static void
+progress_layer(int pegs, long long positions, double done)
+{
+    main_progress.ticks += positions;
+    atomic_store_explicit(&main_progress.nodes, main_progress.ticks, memory_order_relaxed);
+    atomic_store_explicit(&main_progress.samples[pegs],
+                          atomic_load_explicit(&main_progress.samples[pegs], memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+    if (done >= 0) {
+        atomic_store_explicit(&main_progress.done, done, memory_order_relaxed);
+    }
+}
+
+void
+external_bfs(int hole)
+{
+    size_t capacity = memory_budget / sizeof(uint64_t);
+    char layer[SPILL_NAME_LEN];
+    char done[SPILL_NAME_LEN];
+    char runs[MERGE_FANIN][SPILL_NAME_LEN];
+    struct checkpoint ck;
+    long long in_layer = 1;
+    long long read;
+    int pegs = geom.holes - 1;
+    int moves[MAX_MOVES];
+    uint64_t *buf;
+    uint64_t pos;
+    FILE *fp;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "external search needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+    if (memory_limit > 0 && !mem_fits(capacity * sizeof(uint64_t))) {
+        /* Smaller runs just mean more of them to merge */
+        capacity = (memory_limit - mem_total) / sizeof(uint64_t);
+    }
+    if (capacity < MAX_MOVES) {
+        capacity = MAX_MOVES;
+    }
+    mem_need(MEM_FRONTIER, capacity * sizeof(uint64_t));
+    buf = malloc(capacity * sizeof(uint64_t));
+    if (buf == NULL) {
+        fprintf(stderr, "can't allocate %lld bytes for the frontier buffer\n", memory_budget);
+        exit(1);
+    }
+
+    bb64_init();
+    if (checkpoint_load("external", hole, &ck)) {
+        pegs = ck.pegs;
+        in_layer = ck.in_layer;
+        distinct_boards = ck.distinct;
+        total_winning_boards = ck.winning;
+        strcpy(layer, ck.layer);
+    } else {
+        pos = bb64_xor(bb64_valid, bb64_hole[hole]);
+        spill_name(layer, pegs, 0, -1);
+        fp = spill_open(layer, "wb");
+        fwrite(&pos, sizeof(pos), 1, fp);
+        spill_close(fp, layer);
+    }
+
+    while (in_layer > 0) {
+        size_t used = 0;
+        int nruns = 0;
+        int nspilled = 0;
+        int pass = 0;
+        int more;
+
+        if (debug) {
+            printf("Layer %2d pegs: %lld positions\n", pegs, in_layer);
+        }
+        distinct_boards += in_layer;
+        if (pegs == 1) {
+            total_winning_boards = in_layer;
+        }
+
+        fp = spill_open(layer, "rb");
+        read = 0;
+        do {
+            int n = 0;
+            int i;
+
+            more = (fread(&pos, sizeof(pos), 1, fp) == 1);
+            if (more) {
+                n = bb64_gen_moves(pos, moves);
+                if ((++read & (LAYER_PROGRESS - 1)) == 0) {
+                    progress_layer(pegs, LAYER_PROGRESS, layers_done(pegs, 1, (double)read / in_layer));
+                }
+            }
+            if (used > 0 && (used + n > capacity || !more)) {
+                FILE *rp;
+
+                if (nruns == MERGE_FANIN) {
+                    /* Fold the runs so far into one to stay under the fan-in */
+                    char merged[SPILL_NAME_LEN];
+
+                    spill_name(merged, pegs - 1, ++pass, 0);
+                    merge_runs(runs, nruns, merged);
+                    strcpy(runs[0], merged);
+                    nruns = 1;
+                }
+                used = sort_unique(buf, used);
+                spill_name(runs[nruns], pegs - 1, 0, nspilled++);
+                rp = spill_open(runs[nruns], "wb");
+                fwrite(buf, sizeof(uint64_t), used, rp);
+                spill_close(rp, runs[nruns]);
+                nruns++;
+                used = 0;
+            }
+            for (i = 0; i < n; i++) {
+                buf[used++] = bb64_apply(pos, moves[i]);
+            }
+        } while (more);
+        fclose(fp);
+        progress_layer(pegs, read & (LAYER_PROGRESS - 1), layers_done(pegs, 1, 1));
+        /* The layer read is the checkpoint until the next one is saved */
+        strcpy(done, layer);
+        if (!checkpointing) {
+            unlink(done);
+        }
+
+        pegs--;
+        spill_name(layer, pegs, 0, -1);
+        in_layer = merge_runs(runs, nruns, layer);
+        if (checkpointing) {
+            /* The checkpoint names the merged layer, so it must be on disk first */
+            checkpoint_sync(layer);
+            memset(&ck, 0, sizeof(ck));
+            ck.pegs = pegs;
+            ck.in_layer = in_layer;
+            ck.distinct = distinct_boards;
+            ck.winning = total_winning_boards;
+            strcpy(ck.layer, layer);
+            checkpoint_save("external", hole, &ck);
+            unlink(done);
+        }
+        if (in_layer > 0 && layer_stop()) {
+            break;
+        }
+    }
+    if (!atomic_load(&stopped)) {
+        checkpoint_remove("external", hole, 0, -1);
+    }
+    if (!atomic_load(&stopped) || !checkpointing) {
+        unlink(layer);
+    }
+    free(buf);
+    mem_add(MEM_FRONTIER, -(long long)(capacity * sizeof(uint64_t)));
+}
+
+/*
+ * Colex ranking: the positions with k pegs among n holes are numbered 0
+ * to C(n, k) - 1 by rank = sum of C(h_i, i) over the holes h_1 < ... < h_k
+ * with pegs.  So a layer of the search with k pegs can be a dense bit
+ * array indexed by rank, one bit per position, with no keys stored.
+ */
+uint64_t binomial[MAX_RANK_HOLES + 1][MAX_RANK_HOLES + 1];
+
+void
+init_binomial(void)
+{
+    int n;
+    int k;
+
+    for (n = 0; n <= MAX_RANK_HOLES; n++) {
+        binomial[n][0] = 1;
+        for (k = 1; k <= n; k++) {
+            binomial[n][k] = binomial[n - 1][k - 1] + (k < n ? binomial[n - 1][k] : 0);
+        }
+    }
+}
+
+static inline uint64_t
+rank_position(bb64 pegs)
+{
+    uint64_t rank = 0;
+    int i = 0;
+
+    while (!bb64_is_zero(pegs)) {
+        rank += binomial[geom.hole_at[bb64_lsb(pegs)]][++i];
+        pegs = bb64_clear_lsb(pegs);
+    }
+    return rank;
+}
+
+static inline bb64
+unrank_position(uint64_t rank, int k)
+{
+    bb64 pegs = bb64_zero();
+    int h = geom.holes - 1;
+
+    for (; k > 0; k--) {
+        while (binomial[h][k] > rank) {
+            h--;
+        }
+        rank -= binomial[h][k];
+        pegs = bb64_or(pegs, bb64_hole[h]);
+        h--;
+    }
+    return pegs;
+}
+
+/* Set in next the positions one jump on from those in layer, which have pegs pegs */
+static void
+dense_step(const uint64_t *layer, int pegs, uint64_t *next)
+{
+    int moves[MAX_MOVES];
+    uint64_t words = binomial[geom.holes][pegs] / 64 + 1;
+    uint64_t w;
+    long long done = 0;
+
+    for (w = 0; w < words; w++) {
+        uint64_t bits = layer[w];
+
+        if ((w & (LAYER_PROGRESS / 64 - 1)) == 0 && w > 0) {
+            progress_layer(pegs, done, layers_done(pegs, 1, (double)w / words));
+            done = 0;
+        }
+        while (bits != 0) {
+            bb64 pos = unrank_position(64 * w + __builtin_ctzll(bits), pegs);
+            int n = bb64_gen_moves(pos, moves);
+            int i;
+
+            for (i = 0; i < n; i++) {
+                uint64_t r = rank_position(bb64_apply(pos, moves[i]));
+
+                next[r / 64] |= (uint64_t)1 << (r % 64);
+            }
+            done++;
+            bits &= bits - 1;
+        }
+    }
+    progress_layer(pegs, done, layers_done(pegs, 1, 1));
+}
+
+/*
+ * Breadth-first search with each layer as a bit array over the ranks of
+ * its peg count.  The biggest layer of side 7 is C(28, 14) bits, about
+ * 5MB, where a table of 64-bit keys would need 64 times that.
+ */
+void
+dense_bfs(int hole)
+{
+    uint64_t *layer;
+    uint64_t *next;
+    uint64_t words;
+    uint64_t next_words;
+    uint64_t start;
+    struct checkpoint ck;
+    int pegs = geom.holes - 1;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "dense search needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+    bb64_init();
+
+    if (checkpoint_load("dense", hole, &ck)) {
+        pegs = ck.pegs;
+        distinct_boards = ck.distinct;
+    }
+    words = binomial[geom.holes][pegs] / 64 + 1;
+    mem_need(MEM_FRONTIER, words * sizeof(uint64_t));
+    layer = calloc(words, sizeof(uint64_t));
+    if (layer == NULL) {
+        fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs);
+        exit(1);
+    }
+    if (pegs < geom.holes - 1) {
+        layer_load("dense", hole, pegs, layer, words * sizeof(uint64_t));
+    } else {
+        start = rank_position(bb64_xor(bb64_valid, bb64_hole[hole]));
+        layer[start / 64] = (uint64_t)1 << (start % 64);
+    }
+
+    for (;;) {
+        long long in_layer = 0;
+        uint64_t w;
+
+        for (w = 0; w < words; w++) {
+            in_layer += __builtin_popcountll(layer[w]);
+        }
+        if (debug) {
+            printf("Layer %2d pegs: %lld positions\n", pegs, in_layer);
+        }
+        distinct_boards += in_layer;
+        if (pegs == 1) {
+            total_winning_boards = in_layer;
+        }
+        if (pegs == 1 || in_layer == 0) {
+            break;
+        }
+
+        next_words = binomial[geom.holes][pegs - 1] / 64 + 1;
+        mem_need(MEM_FRONTIER, next_words * sizeof(uint64_t));
+        next = calloc(next_words, sizeof(uint64_t));
+        if (next == NULL) {
+            fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs - 1);
+            exit(1);
+        }
+        dense_step(layer, pegs, next);
+        free(layer);
+        mem_add(MEM_FRONTIER, -(long long)(words * sizeof(uint64_t)));
+        layer = next;
+        words = next_words;
+        pegs--;
+        if (checkpointing) {
+            memset(&ck, 0, sizeof(ck));
+            ck.pegs = pegs;
+            ck.distinct = distinct_boards;
+            layer_save("dense", hole, pegs, layer, words * sizeof(uint64_t));
+            checkpoint_save("dense", hole, &ck);
+            layer_remove("dense", hole, pegs + 1);
+        }
+        if (layer_stop()) {
+            break;
+        }
+    }
+    if (!atomic_load(&stopped)) {
+        checkpoint_remove("dense", hole, pegs, geom.holes - 1);
+    }
+    free(layer);
+    mem_add(MEM_FRONTIER, -(long long)(words * sizeof(uint64_t)));
+}
+
+/*
+ * Retrograde analysis.  A position with one peg is won (on the goal hole,
+ * with -g), and a position with k + 1 pegs is won when some jump takes it
+ * to a won position with k, so each layer comes from unjumping every won
+ * position of the layer below.  The layers are the dense bit arrays of
+ * dense_bfs(), and all of them are kept: 2^28 bits, 32MB, for side 7.
+ * Threads take blocks of the layer being read and OR bits into the shared
+ * layer being written, so they need no locks.
+ */
+#define RETRO_BLOCK 1024                    /* words of a layer per task */
+
+_Atomic uint64_t *won[MAX_RANK_HOLES + 1];
+
+struct retro_pass {
+    int pegs;                               /* in the layer being read */
+    int forward;                            /* jumps into won[pegs - 1] */
+    _Atomic uint64_t *from;
+    _Atomic uint64_t *to;
+    uint64_t words;
+    atomic_ullong next_block;
+} current_pass;
+
+struct retro_worker {
+    pthread_t thread;
+    long long states;
+};
+
+static inline uint64_t
+layer_words(int pegs)
+{
+    return binomial[geom.holes][pegs] / 64 + 1;
+}
+
+static inline int
+layer_bit(_Atomic uint64_t *layer, uint64_t rank)
+{
+    return atomic_load_explicit(&layer[rank / 64], memory_order_relaxed) >> (rank % 64) & 1;
+}
+
+static _Atomic uint64_t *
+layer_alloc(int pegs)
+{
+    _Atomic uint64_t *layer;
+
+    mem_need(MEM_FRONTIER, layer_words(pegs) * sizeof(uint64_t));
+    layer = calloc(layer_words(pegs), sizeof(uint64_t));
+    if (layer == NULL) {
+        fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs);
+        exit(1);
+    }
+    return layer;
+}
+
+static void
+layer_free(_Atomic uint64_t *layer, int pegs)
+{
+    free((void *)layer);
+    mem_add(MEM_FRONTIER, -(long long)(layer_words(pegs) * sizeof(uint64_t)));
+}
+
+static long long
+layer_count(_Atomic uint64_t *layer, int pegs)
+{
+    long long count = 0;
+    uint64_t w;
+
+    for (w = 0; w < layer_words(pegs); w++) {
+        count += __builtin_popcountll(atomic_load_explicit(&layer[w], memory_order_relaxed));
+    }
+    return count;
+}
+
+static void *
+retro_thread(void *arg)
+{
+    struct retro_worker *worker = arg;
+    int moves[MAX_MOVES];
+    uint64_t block;
+
+    while ((block = atomic_fetch_add(&current_pass.next_block, 1)) * RETRO_BLOCK < current_pass.words) {
+        uint64_t end = (block + 1) * RETRO_BLOCK < current_pass.words ? (block + 1) * RETRO_BLOCK : current_pass.words;
+        uint64_t w;
+
+        for (w = block * RETRO_BLOCK; w < end; w++) {
+            uint64_t bits = atomic_load_explicit(&current_pass.from[w], memory_order_relaxed);
+
+            while (bits != 0) {
+                bb64 pos = unrank_position(64 * w + __builtin_ctzll(bits), current_pass.pegs);
+                int n = current_pass.forward ? bb64_gen_moves(pos, moves) : bb64_gen_unjumps(pos, moves);
+                int i;
+
+                for (i = 0; i < n; i++) {
+                    uint64_t r = rank_position(bb64_apply(pos, moves[i]));
+
+                    if ((current_pass.forward && !layer_bit(won[current_pass.pegs - 1], r)) || layer_bit(current_pass.to, r)) {
+                        continue;
+                    }
+                    atomic_fetch_or_explicit(&current_pass.to[r / 64], (uint64_t)1 << (r % 64),
+                                             memory_order_relaxed);
+                }
+                worker->states++;
+                bits &= bits - 1;
+            }
+        }
+    }
+    return NULL;
+}
+
+/* One layer to the next, split across the threads; returns the positions read */
+static long long
+retro_layer(int pegs, int forward, _Atomic uint64_t *from, _Atomic uint64_t *to)
+{
+    int nthreads = threads > 0 ? threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    struct retro_worker workers[MAX_THREADS];
+    long long states = 0;
+    int i;
+
+    if (nthreads < 1 || nthreads > MAX_THREADS) {
+        nthreads = nthreads < 1 ? 1 : MAX_THREADS;
+    }
+    current_pass.pegs = pegs;
+    current_pass.forward = forward;
+    current_pass.from = from;
+    current_pass.to = to;
+    current_pass.words = layer_words(pegs);
+    atomic_store(&current_pass.next_block, 0);
+    memset(workers, 0, sizeof(workers));
+    for (i = 0; i < nthreads; i++) {
+        pthread_create(&workers[i].thread, NULL, retro_thread, &workers[i]);
+    }
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(workers[i].thread, NULL);
+        states += workers[i].states;
+    }
+    progress_layer(pegs, states, -1);
+    return states;
+}
+
+/* Fill won[1] to won[holes - 1]; returns the number of won positions */
+long long
+retrograde_solve(int report)
+{
+    struct checkpoint ck;
+    long long total = 0;
+    long long states = 0;
+    double t = now();
+    int first = 1;
+    int pegs;
+    int h;
+
+    if (geom.side < 2 || geom.side > 8) {
+        fprintf(stderr, "retrograde analysis needs a side from 2 to 8\n");
+        exit(1);
+    }
+    bb64_init();
+
+    if (checkpoint_load("retro", -1, &ck)) {
+        first = ck.pegs;
+        states = ck.states;
+        for (pegs = 1; pegs <= first; pegs++) {
+            won[pegs] = layer_alloc(pegs);
+            layer_load("retro", -1, pegs, (void *)won[pegs], layer_words(pegs) * sizeof(uint64_t));
+        }
+    } else {
+        won[1] = layer_alloc(1);
+        for (h = 0; h < geom.holes; h++) {
+            if (goal_hole == 0 || h == goal_hole - 1) {
+                won[1][h / 64] |= (uint64_t)1 << (h % 64);
+            }
+        }
+        if (checkpointing) {
+            layer_save("retro", -1, 1, (void *)won[1], layer_words(1) * sizeof(uint64_t));
+        }
+    }
+    for (pegs = 1; pegs < geom.holes && won[pegs] != NULL; pegs++) {
+        long long count;
+        double lt = now();
+
+        if (pegs >= first && pegs + 1 < geom.holes) {
+            won[pegs + 1] = layer_alloc(pegs + 1);
+            states += retro_layer(pegs, 0, won[pegs], won[pegs + 1]);
+            if (checkpointing) {
+                memset(&ck, 0, sizeof(ck));
+                ck.pegs = pegs + 1;
+                ck.states = states;
+                layer_save("retro", -1, pegs + 1, (void *)won[pegs + 1],
+                           layer_words(pegs + 1) * sizeof(uint64_t));
+                checkpoint_save("retro", -1, &ck);
+            }
+        }
+        count = layer_count(won[pegs], pegs);
+        total += count;
+        if (report) {
+            atomic_store(&main_progress.done, layers_done(pegs, 0, 1));
+            printf("Layer %2d pegs: %12lld of %12llu won (%.3fs)\n", pegs, count,
+                   (unsigned long long)binomial[geom.holes][pegs], now() - lt);
+        }
+        if (pegs >= first && pegs + 1 < geom.holes && layer_stop()) {
+            break;
+        }
+    }
+    t = now() - t;
+    if (atomic_load(&stopped)) {
+        return total;
+    }
+    checkpoint_remove("retro", -1, 1, geom.holes - 1);
+    if (report) {
+        printf("Winnable positions: %lld in %.3fs (%.0f states/s)\n", total, t, t > 0 ? states / t : 0);
+    }
+    return total;
+}
+
+/* Whether the start with hole empty is won */
+int
+retrograde_winnable(int hole)
+{
+    return layer_bit(won[geom.holes - 1], rank_position(bb64_xor(bb64_valid, bb64_hole[hole])));
+}
+
+/*
+ * The won positions that can be reached from a start: a forward search
+ * that only steps onto won positions, since everything on the way to a
+ * won position is won too.
+ */
+long long
+retrograde_reachable(int hole)
+{
+    _Atomic uint64_t *layer;
+    _Atomic uint64_t *next;
+    uint64_t start = rank_position(bb64_xor(bb64_valid, bb64_hole[hole]));
+    long long count = 0;
+    int pegs = geom.holes - 1;
+
+    if (!layer_bit(won[pegs], start)) {
+        return 0;
+    }
+    layer = layer_alloc(pegs);
+    layer[start / 64] = (uint64_t)1 << (start % 64);
+    for (;;) {
+        count += layer_count(layer, pegs);
+        if (pegs == 1) {
+            break;
+        }
+        next = layer_alloc(pegs - 1);
+        retro_layer(pegs, 1, layer, next);
+        layer_free(layer, pegs);
+        layer = next;
+        pegs--;
+    }
+    layer_free(layer, pegs);
+    return count;
+}
+
+void
+retrograde_free(void)
+{
+    int pegs;
+
+    for (pegs = 1; pegs < geom.holes; pegs++) {
+        if (won[pegs] != NULL) {
+            layer_free(won[pegs], pegs);
+            won[pegs] = NULL;
+        }
+    }
+}
+
+/*
+ * Retrograde analysis, then the verdict for every start.  Without a goal
+ * hole the won positions are symmetric, so starts that are reflections or
+ * rotations of one already done share its count.
+ */
+void
+retrograde(void)
+{
+    uint64_t done[MAX_RANK_HOLES];
+    long long counts[MAX_RANK_HOLES];
+    int ndone = 0;
+    int h;
+    int i;
+
+    retrograde_solve(1);
+    if (atomic_load(&stopped)) {
+        printf("Stopped after %.2fs%s\n", now() - search_start,
+               checkpointing ? "; run again with -r to carry on" : "");
+        retrograde_free();
+        return;
+    }
+    for (h = 0; h < geom.holes; h++) {
+        uint64_t key = canonical64(bb64_xor(bb64_valid, bb64_hole[h]));
+        double t = now();
+
+        for (i = 0; i < ndone && (goal_hole != 0 || done[i] != key); i++) {
+        }
+        if (!retrograde_winnable(h)) {
+            printf("Hole %2d: lost\n", h + 1);
+        } else if (i < ndone) {
+            printf("Hole %2d: winnable, %lld won positions reachable (by symmetry)\n", h + 1, counts[i]);
+        } else {
+            done[ndone] = key;
+            counts[ndone] = retrograde_reachable(h);
+            printf("Hole %2d: winnable, %lld won positions reachable (%.3fs)\n", h + 1, counts[ndone],
+                   now() - t);
+            ndone++;
+        }
+    }
+    retrograde_free();
+}
+
+/*
+ * Graph export.  -X writes every position reachable from the start, each
+ * once, with the jumps between them, to stdout: as DOT (-X dot) or as
+ * compact sparse rows (-X csr).  The graph is built a layer at a time as
+ * for -D, and each layer is written as soon as the next one is known, so
+ * no more than two layers are ever held besides the won positions from
+ * retrograde analysis.  Nodes are numbered from 0 at the start, layer by
+ * layer and by rank within a layer.
+ *
+ * The CSR file is the header then one block per layer, little-endian:
+ *
+ *   header  "TRIGRAPH", then side, start hole and goal hole (0 for any),
+ *           4 bytes each, and 4 reserved
+ *   block   pegs and 4 reserved bytes; the first node's number, the
+ *           number of nodes and the number of edges, 8 bytes each; then
+ *           the nodes' positions (holes as bits, hole 1 lowest), 8 bytes
+ *           each; their flags (GRAPH_WON), a byte each; the offsets of
+ *           their edges from the block's first, nodes + 1 of them, 8
+ *           bytes each; the edges' target nodes, 8 bytes each; and the
+ *           jumps, a byte each for the 1-based from and to holes
+ *
+ * A block with no nodes ends the file.
+ */
+/* The holes of a position as bits, hole 1 lowest */
+static uint64_t
+position_holes(bb64 pegs)
+{
+    uint64_t holes = 0;
+    int h;
+
+    for (h = 0; h < geom.holes; h++) {
+        if (!bb64_is_zero(bb64_and(pegs, bb64_hole[h]))) {
+            holes |= (uint64_t)1 << h;
+        }
+    }
+    return holes;
+}
+
+/* For each word of a layer, how many positions come before it */
+static void
+layer_index(const uint64_t *layer, uint64_t words, uint64_t *before)
+{
+    uint64_t count = 0;
+    uint64_t w;
+
+    for (w = 0; w < words; w++) {
+        before[w] = count;
+        count += __builtin_popcountll(layer[w]);
+    }
+}
+
+/* The number of the node of rank r in a layer numbered from first */
+static inline uint64_t
+node_number(const uint64_t *layer, const uint64_t *before, uint64_t first, uint64_t r)
+{
+    return first + before[r / 64] + __builtin_popcountll(layer[r / 64] & (((uint64_t)1 << (r % 64)) - 1));
+}
+
+static void
+put_graph(uint64_t v, int n)
+{
+    unsigned char buf[8];
+
+    put_le(buf, v, n);
+    sink_write(&out, buf, n);
+}
+
+/*
+ * Write one layer.  DOT takes one pass; CSR a pass for the edge counts and
+ * flags, then one for each of positions, targets and jumps, so that only
+ * a byte per node is kept and the edges are never held.
+ */
+static void
+write_graph_layer(const uint64_t *layer, int pegs, uint64_t first, const uint64_t *next,
+                  const uint64_t *next_before, uint64_t next_first)
+{
+    int moves[MAX_MOVES];
+    uint64_t words = binomial[geom.holes][pegs] / 64 + 1;
+    uint64_t nodes = 0;
+    uint64_t edges = 0;
+    unsigned char *degree = NULL;
+    unsigned char *flags = NULL;
+    uint64_t node = first;
+    uint64_t w;
+    uint64_t j;
+    int pass;
+    int i;
+
+    for (w = 0; w < words; w++) {
+        nodes += __builtin_popcountll(layer[w]);
+    }
+    if (graph_format == GRAPH_CSR) {
+        mem_need(MEM_FRONTIER, 2 * nodes);
+        degree = malloc(nodes + 1);
+        flags = malloc(nodes + 1);
+        if (degree == NULL || flags == NULL) {
+            fprintf(stderr, "can't allocate the edge counts for %d pegs\n", pegs);
+            exit(1);
+        }
+    }
+
+    /* DOT: pass 0 only; CSR: counts, positions, flags and offsets, targets, jumps */
+    for (pass = 0; pass < (graph_format == GRAPH_CSR ? 4 : 1); pass++) {
+        uint64_t offset = 0;
+
+        if (graph_format == GRAPH_CSR && pass == 1) {
+            put_graph(pegs, 4);
+            put_graph(0, 4);
+            put_graph(first, 8);
+            put_graph(nodes, 8);
+            put_graph(edges, 8);
+        }
+        node = first;
+        for (w = 0; w < words; w++) {
+            uint64_t bits = layer[w];
+
+            while (bits != 0) {
+                uint64_t r = 64 * w + __builtin_ctzll(bits);
+                bb64 pos = unrank_position(r, pegs);
+                int n = (pegs > 1 ? bb64_gen_moves(pos, moves) : 0);
+                int won_here = layer_bit(won[pegs], r);
+
+                if (graph_format == GRAPH_DOT) {
+                    sink_printf(&out, "  %llu [label=\"%#llx\", pegs=%d, won=%d];\n", (unsigned long long)node,
+                                (unsigned long long)position_holes(pos), pegs, won_here);
+                }
+                if (pass == 0 && graph_format == GRAPH_CSR) {
+                    degree[node - first] = n;
+                    flags[node - first] = won_here ? GRAPH_WON : 0;
+                    edges += n;
+                } else if (pass == 1) {
+                    put_graph(position_holes(pos), 8);
+                }
+                for (i = 0; i < n && (graph_format == GRAPH_DOT || pass >= 2); i++) {
+                    uint64_t target = node_number(next, next_before, next_first,
+                                                  rank_position(bb64_apply(pos, moves[i])));
+                    struct move *mv = &geom.moves[moves[i]];
+
+                    if (graph_format == GRAPH_DOT) {
+                        sink_printf(&out, "  %llu -> %llu [label=\"%d-%d\"];\n", (unsigned long long)node,
+                                    (unsigned long long)target, mv->from + 1, mv->to + 1);
+                    } else if (pass == 2) {
+                        put_graph(target, 8);
+                    } else {
+                        put_graph(mv->from + 1, 1);
+                        put_graph(mv->to + 1, 1);
+                    }
+                }
+                node++;
+                bits &= bits - 1;
+            }
+        }
+        if (graph_format == GRAPH_CSR && pass == 1) {
+            sink_write(&out, flags, nodes);
+            for (j = 0; j < nodes; j++) {
+                put_graph(offset, 8);
+                offset += degree[j];
+            }
+            put_graph(offset, 8);
+        }
+    }
+
+    if (graph_format == GRAPH_CSR) {
+        free(degree);
+        free(flags);
+        mem_add(MEM_FRONTIER, -(long long)(2 * nodes));
+    }
+}
+
+void
+export_graph(int hole)
+{
+    uint64_t *layer;
+    uint64_t *next = NULL;
+    uint64_t *next_before = NULL;
+    uint64_t words;
+    uint64_t first = 0;
+    uint64_t count = 1;
+    uint64_t start;
+    int pegs = geom.holes - 1;
+
+    if (geom.side < 2 || geom.side > 8) {
+        fprintf(stderr, "graph export needs a side from 2 to 8\n");
+        exit(1);
+    }
+    retrograde_solve(0);
+    words = layer_words(pegs);
+    mem_need(MEM_FRONTIER, words * sizeof(uint64_t));
+    layer = calloc(words, sizeof(uint64_t));
+    if (layer == NULL) {
+        fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs);
+        exit(1);
+    }
+    start = rank_position(bb64_xor(bb64_valid, bb64_hole[hole]));
+    layer[start / 64] = (uint64_t)1 << (start % 64);
+
+    if (graph_format == GRAPH_DOT) {
+        sink_printf(&out, "digraph triangle_side_%d_hole_%d {\n", geom.side, hole + 1);
+    } else {
+        sink_write(&out, "TRIGRAPH", 8);
+        put_graph(geom.side, 4);
+        put_graph(hole + 1, 4);
+        put_graph(goal_hole, 4);
+        put_graph(0, 4);
+    }
+
+    while (count > 0) {
+        uint64_t next_count = 0;
+        uint64_t next_words = 0;
+        uint64_t w;
+
+        if (pegs > 1) {
+            next_words = layer_words(pegs - 1);
+            mem_need(MEM_FRONTIER, 2 * next_words * sizeof(uint64_t));
+            next = calloc(next_words, sizeof(uint64_t));
+            next_before = malloc(next_words * sizeof(uint64_t));
+            if (next == NULL || next_before == NULL) {
+                fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs - 1);
+                exit(1);
+            }
+            dense_step(layer, pegs, next);
+            layer_index(next, next_words, next_before);
+            for (w = 0; w < next_words; w++) {
+                next_count += __builtin_popcountll(next[w]);
+            }
+        }
+        write_graph_layer(layer, pegs, first, next, next_before, first + count);
+
+        free(layer);
+        mem_add(MEM_FRONTIER, -(long long)(words * sizeof(uint64_t)));
+        if (next_before != NULL) {
+            free(next_before);
+            mem_add(MEM_FRONTIER, -(long long)(next_words * sizeof(uint64_t)));
+            next_before = NULL;
+        }
+        layer = next;
+        words = next_words;
+        next = NULL;
+        first += count;
+        count = next_count;
+        pegs--;
+    }
+    free(layer);
+    mem_add(MEM_FRONTIER, -(long long)(words * sizeof(uint64_t)));
+
+    if (graph_format == GRAPH_DOT) {
+        sink_printf(&out, "}\n");
+    } else {
+        put_graph(0, 8);
+        put_graph(first, 8);
+        put_graph(0, 8);
+        put_graph(0, 8);
+    }
+    sink_flush(&out);
+    retrograde_free();
+}
+
+/*
+ * How games end.  A game is over when no jump is left, and is scored by
+ * the pegs left then.  Going forward a layer at a time as for -D, every
+ * position reached carries the number of lines of play that reach it, the
+ * sum of those of the positions one jump back; one with no jumps adds its
+ * lines to the count for its peg count, and itself to the count of
+ * distinct end positions.  So each position is worked on once however
+ * many lines pass through it.  Line counts are 128 bits, as side 7's don't
+ * fit in 64.
+ */
+typedef unsigned __int128 line_count;
+
+line_count end_lines[MAX_RANK_HOLES + 1];
+long long end_positions[MAX_RANK_HOLES + 1];
+line_count goal_lines;                      /* the one-peg ends on the -g hole */
+long long goal_positions;
+line_count all_lines;                       /* boards, as for the full search */
+
+static uint64_t *
+outcome_alloc(uint64_t n, size_t size, int pegs)
+{
+    uint64_t *p;
+
+    mem_need(MEM_FRONTIER, n * size);
+    p = calloc(n > 0 ? n : 1, size);
+    if (p == NULL) {
+        fprintf(stderr, "can't allocate the layer for %d pegs\n", pegs);
+        exit(1);
+    }
+    return p;
+}
+
+static void
+outcome_free(void *p, uint64_t n, size_t size)
+{
+    free(p);
+    mem_add(MEM_FRONTIER, -(long long)(n * size));
+}
+
+/* Fill end_lines and end_positions, and the usual counters where they fit */
+void
+outcome_solve(int hole)
+{
+    int moves[MAX_MOVES];
+    uint64_t *layer;
+    uint64_t *before;
+    line_count *lines;
+    uint64_t words;
+    uint64_t count = 1;
+    uint64_t start;
+    int pegs = geom.holes - 1;
+
+    if (geom.side > 8) {
+        fprintf(stderr, "the outcome count needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+    bb64_init();
+    memset(end_lines, 0, sizeof(end_lines));
+    memset(end_positions, 0, sizeof(end_positions));
+    goal_lines = 0;
+    goal_positions = 0;
+    all_lines = 0;
+    distinct_boards = 0;
+
+    words = layer_words(pegs);
+    layer = outcome_alloc(words, sizeof(uint64_t), pegs);
+    before = outcome_alloc(words, sizeof(uint64_t), pegs);
+    start = rank_position(bb64_xor(bb64_valid, bb64_hole[hole]));
+    layer[start / 64] = (uint64_t)1 << (start % 64);
+    layer_index(layer, words, before);
+    lines = (line_count *)outcome_alloc(count, sizeof(line_count), pegs);
+    lines[0] = 1;
+
+    while (count > 0) {
+        uint64_t *next = NULL;
+        uint64_t *next_before = NULL;
+        line_count *next_lines = NULL;
+        uint64_t next_words = 0;
+        uint64_t next_count = 0;
+        uint64_t node = 0;
+        uint64_t w;
+
+        if (pegs > 1) {
+            next_words = layer_words(pegs - 1);
+            next = outcome_alloc(next_words, sizeof(uint64_t), pegs - 1);
+            next_before = outcome_alloc(next_words, sizeof(uint64_t), pegs - 1);
+            dense_step(layer, pegs, next);
+            layer_index(next, next_words, next_before);
+            for (w = 0; w < next_words; w++) {
+                next_count += __builtin_popcountll(next[w]);
+            }
+            next_lines = (line_count *)outcome_alloc(next_count, sizeof(line_count), pegs - 1);
+        }
+
+        for (w = 0; w < words; w++) {
+            uint64_t bits = layer[w];
+
+            while (bits != 0) {
+                bb64 pos = unrank_position(64 * w + __builtin_ctzll(bits), pegs);
+                int n = (pegs > 1 ? bb64_gen_moves(pos, moves) : 0);
+                int i;
+
+                all_lines += lines[node];
+                if (n == 0) {
+                    end_lines[pegs] += lines[node];
+                    end_positions[pegs]++;
+                    if (pegs == 1 && goal_hole && !bb64_is_zero(bb64_and(pos, bb64_hole[goal_hole - 1]))) {
+                        goal_lines += lines[node];
+                        goal_positions++;
+                    }
+                }
+                for (i = 0; i < n; i++) {
+                    uint64_t r = rank_position(bb64_apply(pos, moves[i]));
+
+                    next_lines[node_number(next, next_before, 0, r)] += lines[node];
+                }
+                node++;
+                bits &= bits - 1;
+            }
+        }
+        distinct_boards += count;
+
+        outcome_free(layer, words, sizeof(uint64_t));
+        outcome_free(before, words, sizeof(uint64_t));
+        outcome_free(lines, count, sizeof(line_count));
+        layer = next;
+        before = next_before;
+        lines = next_lines;
+        words = next_words;
+        count = next_count;
+        pegs--;
+    }
+    if (layer != NULL) {
+        outcome_free(layer, words, sizeof(uint64_t));
+        outcome_free(before, words, sizeof(uint64_t));
+        outcome_free(lines, count, sizeof(line_count));
+    }
+
+    total_boards = (all_lines <= (line_count)INT64_MAX ? (long long)all_lines : -1);
+    if (goal_hole) {
+        total_winning_boards = (goal_lines <= (line_count)INT64_MAX ? (long long)goal_lines : -1);
+    } else {
+        total_winning_boards = (end_lines[1] <= (line_count)INT64_MAX ? (long long)end_lines[1] : -1);
+    }
+}
+
+/* A line count in decimal; buf must hold 40 characters */
+static char *
+line_count_str(line_count n, char *buf)
+{
+    char *p = buf + 39;
+
+    *p = '\0';
+    do {
+        *--p = '0' + (int)(n % 10);
+        n /= 10;
+    } while (n > 0);
+    return p;
+}
+
+void
+outcome_report(int hole)
+{
+    char buf[40];
+    line_count lines = 0;
+    long long positions = 0;
+    double t = now();
+    int k;
+
+    outcome_solve(hole);
+    t = now() - t;
+    printf("Pegs left  %26s  %14s\n", "lines of play", "end positions");
+    for (k = 1; k < geom.holes; k++) {
+        if (end_positions[k] > 0) {
+            printf("%9d  %26s  %14lld\n", k, line_count_str(end_lines[k], buf), end_positions[k]);
+            if (k == 1 && goal_hole) {
+                printf("    at %-2d  %26s  %14lld\n", goal_hole, line_count_str(goal_lines, buf), goal_positions);
+            }
+            lines += end_lines[k];
+            positions += end_positions[k];
+        }
+    }
+    printf("Total      %26s  %14lld\n", line_count_str(lines, buf), positions);
+    printf("Boards: %s in every line of play, %lld distinct, counted in %.3fs\n",
+           line_count_str(all_lines, buf), distinct_boards, t);
+    print_memory();
+}
+
+/*
+ * Time canonicalising random positions with the tables against doing it
+ * a hole at a time, and check they agree.
+ */
+void
+benchmark_symmetry(long long n)
+{
+    uint64_t *positions = malloc(n * sizeof(uint64_t));
+    uint64_t rng = 0x73796d6d65747279ULL;
+    uint64_t naive_sum = 0;
+    uint64_t table_sum = 0;
+    long long mismatches = 0;
+    double naive_time;
+    double table_time;
+    long long i;
+    int h;
+
+    if (positions == NULL || sym_chunks == 0) {
+        fprintf(stderr, "symmetry benchmark needs a board that fits in 64 bits (side 8 or less)\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        positions[i] = 0;
+        for (h = 0; h < geom.holes; h++) {
+            if (splitmix64(&rng) & 1) {
+                positions[i] |= (uint64_t)1 << geom.bit[h];
+            }
+        }
+    }
+
+    naive_time = now();
+    for (i = 0; i < n; i++) {
+        naive_sum += canonical64_naive(positions[i]);
+    }
+    naive_time = now() - naive_time;
+
+    table_time = now();
+    for (i = 0; i < n; i++) {
+        table_sum += canonical64(positions[i]);
+    }
+    table_time = now() - table_time;
+
+    for (i = 0; i < n; i++) {
+        mismatches += (canonical64(positions[i]) != canonical64_naive(positions[i]));
+    }
+
+    printf("Canonical form of %lld positions on side %d (%d table chunks):\n", n, geom.side, sym_chunks);
+    printf("  per hole: %8.2f ns each\n", 1e9 * naive_time / n);
+    printf("  tables:   %8.2f ns each (%.1fx)\n", 1e9 * table_time / n,
+           table_time > 0 ? naive_time / table_time : 0);
+    printf("  %lld mismatches%s\n", mismatches, naive_sum == table_sum ? "" : ", sums differ");
+    free(positions);
+}
+
+/*
+ * Replay a line from the starting position, printing each board.
+ */
+void
+replay_line(int hole, const move_index *line, int nmoves)
+{
+    unsigned char pegs[MAX_HOLES];
+    int i;
+
+    memset(pegs, 1, sizeof(pegs));
+    pegs[hole] = 0;
+    print_holes(pegs, -1);
+    for (i = 0; i < nmoves; i++) {
+        const struct move *m = &geom.moves[line[i]];
+
+        pegs[m->from] = 0;
+        pegs[m->over] = 0;
+        pegs[m->to] = 1;
+        print_holes(pegs, m->to);
+    }
+}
+
+void
+print_solutions(int hole)
+{
+    long long i;
+
+    if (first_only && first_time >= 0) {
+        printf("First solution after %.4fs and %lld boards\n", first_time, first_boards);
+    } else if (atomic_load(&stopped)) {
+        printf("Search stopped after %.2fs; the counts are of the boards reached by then\n",
+               now() - search_start);
+    }
+    for (i = 0; i < nsolutions; i++) {
+        if (nsolutions > 1) {
+            printf("Solution %lld:\n", i + 1);
+        }
+        replay_line(hole, solutions + i * (geom.holes - 2), geom.holes - 2);
+    }
+    if (nsolutions == 0 && time_limit > 0 && best_pegs <= geom.holes) {
+        printf("Best line found leaves %d pegs:\n", best_pegs);
+        replay_line(hole, best_path, geom.holes - 1 - best_pegs);
+    }
+}
+
+/*
+ * The result of solving from a starting hole, with the winning lines kept,
+ * in the -o format.
+ */
+void
+write_result(int hole, long long boards, int flags, double seconds)
+{
+    uint64_t position = 0;
+    long long i;
+    int h;
+
+    if (geom.holes <= 64) {
+        for (h = 0; h < geom.holes; h++) {
+            if (h != hole) {
+                position |= (uint64_t)1 << h;
+            }
+        }
+    }
+    if (atomic_load(&stopped) && !(first_only && first_time >= 0)) {
+        flags |= RECORD_STOPPED;
+    }
+    output_result(hole + 1, position, boards, total_winning_boards, seconds, flags, nsolutions);
+    for (i = 0; i < nsolutions; i++) {
+        output_line(solutions + i * (geom.holes - 2), i == 0, i == nsolutions - 1);
+    }
+    sink_flush(&out);
+}
+
+/*
+ * Regression suite, in the spirit of chess "perft": every engine is run
+ * from every starting hole of the small boards and its counts are checked
+ * against a table recorded from earlier runs, with each run timed.  The
+ * number of boards is of every line of play (nodes in the full tree),
+ * distinct is of different positions, and winning is lines ending with one
+ * peg.  Engines too slow for a case are skipped.
+ */
+struct perft_case {
+    int side;
+    int hole;
+    long long boards;
+    long long distinct;
+    long long winning;
+};
+
+struct perft_case perft_cases[] = {
+    { 3,  1,               7LL,      6,              0LL },
+    { 3,  2,               1LL,      1,              0LL },
+    { 3,  3,               1LL,      1,              0LL },
+    { 3,  4,               7LL,      6,              0LL },
+    { 3,  5,               1LL,      1,              0LL },
+    { 3,  6,               7LL,      6,              0LL },
+    { 4,  1,             119LL,     42,              0LL },
+    { 4,  2,             260LL,     62,             14LL },
+    { 4,  3,             260LL,     62,             14LL },
+    { 4,  4,             260LL,     62,             14LL },
+    { 4,  5,               1LL,      1,              0LL },
+    { 4,  6,             260LL,     62,             14LL },
+    { 4,  7,             119LL,     42,              0LL },
+    { 4,  8,             260LL,     62,             14LL },
+    { 4,  9,             260LL,     62,             14LL },
+    { 4, 10,             119LL,     42,              0LL },
+    { 5,  1,         1293179LL,   3016,          29760LL },
+    { 5,  2,          671085LL,   2377,          14880LL },
+    { 5,  3,          671085LL,   2377,          14880LL },
+    { 5,  4,         2592133LL,   4237,          85258LL },
+    { 5,  5,          323873LL,   1651,           1550LL },
+    { 5,  6,         2592133LL,   4237,          85258LL },
+    { 5,  7,          671085LL,   2377,          14880LL },
+    { 5,  8,          323873LL,   1651,           1550LL },
+    { 5,  9,          323873LL,   1651,           1550LL },
+    { 5, 10,          671085LL,   2377,          14880LL },
+    { 5, 11,         1293179LL,   3016,          29760LL },
+    { 5, 12,          671085LL,   2377,          14880LL },
+    { 5, 13,         2592133LL,   4237,          85258LL },
+    { 5, 14,          671085LL,   2377,          14880LL },
+    { 5, 15,         1293179LL,   3016,          29760LL },
+    { 6,  1,    818569383179LL, 291987,    43419942138LL },
+    { 6,  2,   1471316219557LL, 291222,    82905434589LL },
+    { 6,  3,   1471316219557LL, 291222,    82905434589LL },
+    { 6,  4,   2044798338480LL, 329588,   113077359159LL },
+    { 6,  5,    528712651847LL, 227050,    29235690234LL },
+    { 6,  6,   2044798338480LL, 329588,   113077359159LL },
+    { 6,  7,   2044798338480LL, 329588,   113077359159LL },
+    { 6,  8,   4506402479487LL, 340038,   266871356732LL },
+    { 6,  9,   4506402479487LL, 340038,   266871356732LL },
+    { 6, 10,   2044798338480LL, 329588,   113077359159LL },
+    { 6, 11,   1471316219557LL, 291222,    82905434589LL },
+    { 6, 12,    528712651847LL, 227050,    29235690234LL },
+    { 6, 13,   4506402479487LL, 340038,   266871356732LL },
+    { 6, 14,    528712651847LL, 227050,    29235690234LL },
+    { 6, 15,   1471316219557LL, 291222,    82905434589LL },
+    { 6, 16,    818569383179LL, 291987,    43419942138LL },
+    { 6, 17,   1471316219557LL, 291222,    82905434589LL },
+    { 6, 18,   2044798338480LL, 329588,   113077359159LL },
+    { 6, 19,   2044798338480LL, 329588,   113077359159LL },
+    { 6, 20,   1471316219557LL, 291222,    82905434589LL },
+    { 6, 21,    818569383179LL, 291987,    43419942138LL },
+};
+
+#define NUM_PERFT_CASES (int)(sizeof(perft_cases) / sizeof(perft_cases[0]))
+#define PERFT_DFS_LIMIT 100000000LL     /* boards; more than this is too slow */
+
+void
+reset_counters(void)
+{
+    total_boards = 1;
+    total_winning_boards = 0;
+    distinct_boards = 0;
+    pagoda_cuts = 0;
+    depth = 0;
+    nsolutions = 0;
+    first_time = -1;
+    memset(&tt_totals, 0, sizeof(tt_totals));
+}
+
+static int
+perft_compare(const char *engine, const char *what, long long got, long long want, double t)
+{
+    printf("  %-9s %-9s %18lld", engine, what, got);
+    if (t >= 0) {
+        printf("  %8.3fs", t);
+    } else {
+        printf("           ");
+    }
+    if (got != want) {
+        printf("  FAILED, expected %lld\n", want);
+        return 1;
+    }
+    printf("  ok\n");
+    return 0;
+}
+
+#define UNJUMP_POSITIONS 10000
+
+/*
+ * Unjumps must exactly undo jumps, for every word width and board size,
+ * and on the standard board the grid and bitboard versions must agree.
+ */
+static int
+perft_unjumps(void)
+{
+    uint64_t rng = 0x756e6a756d70ULL;
+    int failures = 0;
+    int n;
+    int i;
+
+    for (n = 3; n <= MAX_SIDE; n++) {
+        int bad;
+
+        init_geometry(n);
+        if (n * n <= 64) {
+            bad = bb64_check_unjumps(UNJUMP_POSITIONS, &rng);
+        } else if (n * n <= 128) {
+            bad = bb128_check_unjumps(UNJUMP_POSITIONS, &rng);
+        } else {
+            bad = bbp256_check_unjumps(UNJUMP_POSITIONS, &rng);
+#ifdef __AVX2__
+            bad += bb256_check_unjumps(UNJUMP_POSITIONS, &rng);
+#endif
+        }
+        if (bad) {
+            printf("  unjumps   side %2d   %d moves not inverted  FAILED\n", n, bad);
+        }
+        failures += bad;
+    }
+
+    init_geometry(DEFAULT_SIDE);
+    bb64_init();
+    for (i = 0; i < UNJUMP_POSITIONS; i++) {
+        struct board b;
+        struct board prev;
+        struct squares prevs[MAX_MOVES];
+        int moves[MAX_MOVES];
+        uint64_t want = 0;
+        uint64_t got = 0;
+        int nprevs;
+        int row;
+        int col;
+        int j;
+
+        memset(&b, 0, sizeof(b));
+        for (row = 0; row < NUM_ROWS; row++) {
+            for (col = 0; col < NUM_COLS; col++) {
+                b.squares[row][col] = (grid_hole[row][col] < 0 ? POS_INVALID : (splitmix64(&rng) & 1));
+            }
+        }
+
+        /* Compare the two as sets, by XORing together hashes of the predecessors */
+        nprevs = unjump_boards(&b, prevs);
+        for (j = 0; j < nprevs; j++) {
+            memcpy(prev.squares, prevs[j].s, sizeof(prev.squares));
+            got ^= board_pegs(&prev) * 0x9e3779b97f4a7c15ULL;
+        }
+        n = bb64_gen_unjumps(board_pegs(&b), moves);
+        for (j = 0; j < n; j++) {
+            want ^= bb64_apply(board_pegs(&b), moves[j]) * 0x9e3779b97f4a7c15ULL;
+        }
+        if (n != nprevs || got != want) {
+            failures++;
+        }
+    }
+
+    printf("unjumps: %d positions per board size, %d failures\n", UNJUMP_POSITIONS, failures);
+    return failures;
+}
+
+#ifdef __AVX2__
+/*
+ * The vector and portable 256-bit words must play the same random games
+ * from the same seed, and -f must find the same first line with each
+ * after the same number of boards.
+ */
+#define VECTOR_GAMES 2000
+#define VECTOR_SIDE  12                     /* -f from VECTOR_HOLE is quick */
+#define VECTOR_HOLE  7
+
+int
+perft_vector(void)
+{
+    struct playout_worker a;
+    struct playout_worker b;
+    move_index line[MAX_DEPTH];
+    long long boards = 0;
+    int failures = 0;
+    int n;
+
+    for (n = 12; n <= MAX_SIDE; n++) {
+        init_geometry(n);
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        a.rng = b.rng = 0x766563746f72ULL + n;
+        bb256_init();
+        bb256_playouts(0, VECTOR_GAMES, &a);
+        bbp256_init();
+        bbp256_playouts(0, VECTOR_GAMES, &b);
+        if (a.wins != b.wins || memcmp(a.pegs_left, b.pegs_left, sizeof(a.pegs_left)) != 0) {
+            printf("  vector    side %2d   playouts differ  FAILED\n", n);
+            failures++;
+        }
+    }
+
+    init_geometry(VECTOR_SIDE);
+    first_only = 1;
+    for (n = 0; n < 2; n++) {
+        reset_counters();
+        atomic_store(&stopped, 0);
+        if (n == 0) {
+            bb256_solve(VECTOR_HOLE - 1);
+            boards = total_boards;
+            memcpy(line, solutions, (geom.holes - 2) * sizeof(move_index));
+        } else {
+            bbp256_solve(VECTOR_HOLE - 1);
+        }
+        atomic_store(&stopped, 0);
+    }
+    first_only = 0;
+    if (nsolutions != 1 || total_boards != boards ||
+        memcmp(line, solutions, (geom.holes - 2) * sizeof(move_index)) != 0) {
+        printf("  vector    side %2d   first solutions differ  FAILED\n", VECTOR_SIDE);
+        failures++;
+    }
+    reset_counters();
+    init_geometry(DEFAULT_SIDE);
+    bb64_init();
+
+    printf("vector: %d games per board size, %d failures\n", VECTOR_GAMES, failures);
+    return failures;
+}
+#endif
+
+/*
+ * The built-in winnability table must match one worked out afresh, and
+ * agree with the hashed search on every position reachable from a start.
+ */
+int
+perft_winnable(void)
+{
+    unsigned char table[WINNABLE15_BYTES];
+    struct search_worker w;
+    int failures = 0;
+    int count = 0;
+    int i;
+
+    init_geometry(WINNABLE15_SIDE);
+    winnable_compute(table);
+    for (i = 0; i < WINNABLE15_BYTES * 8; i++) {
+        count += winnable15[i / 8] >> (i % 8) & 1;
+    }
+    failures += (memcmp(table, winnable15, sizeof(table)) != 0);
+
+    bb64_init();
+    tt_init(hash_size);
+    memset(&w, 0, sizeof(w));
+    for (i = 0; i < geom.holes; i++) {
+        bb64 start = bb64_xor(bb64_valid, bb64_hole[i]);
+        uint64_t nodes;
+        uint64_t wins;
+
+        tt_search(start, bb64_hash(start), &nodes, &wins, &w);
+        failures += ((wins > 0) != winnable(start));
+    }
+    tt_free();
+
+    printf("winnable15.h: %d of %d positions winnable, %s\n", count, WINNABLE15_BYTES * 8,
+           failures == 0 ? "ok" : "MISMATCH");
+    return failures;
+}
+
+/*
+ * Ranking random positions of every peg count on every board that fits in
+ * 64 bits must give a rank in range that unranks to the same position.
+ */
+int
+perft_ranks(void)
+{
+    uint64_t rng = 0x72616e6b73ULL;
+    int failures = 0;
+    int n;
+    int i;
+
+    for (n = 3; n <= 8; n++) {
+        init_geometry(n);
+        bb64_init();
+        for (i = 0; i < UNJUMP_POSITIONS; i++) {
+            bb64 pegs = splitmix64(&rng) & bb64_valid;
+            int k = bb64_popcount(pegs);
+            uint64_t r = rank_position(pegs);
+
+            failures += (r >= binomial[geom.holes][k] || unrank_position(r, k) != pegs);
+        }
+    }
+    printf("ranks: %d positions per board size, %d failures\n", UNJUMP_POSITIONS, failures);
+    return failures;
+}
+
+/*
+ * Retrograde analysis of the standard board must find exactly the won
+ * positions the built-in table has.
+ */
+int
+perft_retrograde(void)
+{
+    int failures = 0;
+    uint32_t p;
+    int h;
+
+    init_geometry(WINNABLE15_SIDE);
+    retrograde_solve(0);
+    for (p = 0; p < WINNABLE15_BYTES * 8; p++) {
+        bb64 pegs = bb64_zero();
+        int k;
+
+        for (h = 0; h < geom.holes; h++) {
+            if (p >> h & 1) {
+                pegs = bb64_or(pegs, bb64_hole[h]);
+            }
+        }
+        k = bb64_popcount(pegs);
+        failures += ((k >= 1 && k < geom.holes && layer_bit(won[k], rank_position(pegs))) != winnable(pegs));
+    }
+    retrograde_free();
+    printf("retrograde: %d positions against winnable15.h, %d failures\n", WINNABLE15_BYTES * 8, failures);
+    return failures;
+}
+
+/*
+ * Under -L the hash table may be cut, but only so far: a limit that
+ * leaves a usable table must still give the right counts, and one that
+ * doesn't must be refused rather than left to thrash.
+ */
+static int
+perft_memory_limit(struct perft_case *pc)
+{
+    long long saved = memory_limit;
+    size_t wanted;
+    int failures = 0;
+    double t;
+
+    init_geometry(pc->side);
+    printf("side %d hole %2d with -L\n", pc->side, pc->hole);
+    memory_limit = hash_size / 4 + mem_total;
+    reset_counters();
+    t = now();
+    parallel_solve(pc->hole - 1);
+    t = now() - t;
+    failures += perft_compare("limited", "boards", total_boards, pc->boards, t);
+    failures += perft_compare("limited", "winning", total_winning_boards, pc->winning, -1);
+
+    memory_limit = mem_total + (1 << 20);
+    failures += perft_compare("too small", "entries", tt_entries(hash_size, &wanted), 0, -1);
+    memory_limit = saved;
+    return failures;
+}
+
+static uint64_t
+get_le(const unsigned char *p, int n)
+{
+    uint64_t v = 0;
+
+    while (n-- > 0) {
+        v = v << 8 | p[n];
+    }
+    return v;
+}
+
+/* Make room for more of the graph read back, or give up */
+static void *
+graph_grow(void *p, size_t bytes)
+{
+    void *q = realloc(p, bytes);
+
+    if (q == NULL) {
+        fprintf(stderr, "out of memory for the graph read back\n");
+        exit(1);
+    }
+    return q;
+}
+
+/*
+ * Export the graph as CSR to a temporary file and read it back.  The
+ * blocks must number their nodes without gaps, each edge must lead into
+ * the next block, and the nodes must be the distinct positions; returns
+ * their number, or -1 if the file is malformed.  On the standard board
+ * the whole graph is kept as it is read, and each node's won flag must
+ * agree with the built-in table, and each edge's jump must be legal from
+ * its node and lead to its target.
+ */
+static long long
+perft_graph(int hole)
+{
+    FILE *saved = out.fp;
+    FILE *fp = tmpfile();
+    unsigned char buf[32];
+    uint64_t next_first = 0;
+    uint64_t targets_end = 0;               /* one past the highest target */
+    long long total = 0;
+    int keep = use_winnable_table();
+    uint64_t *positions = NULL;             /* with keep, for every node: */
+    unsigned char *flags = NULL;
+    uint64_t *sources = NULL;               /* and for every edge: */
+    uint64_t *targets = NULL;
+    unsigned char *jumps = NULL;
+    uint64_t nedges = 0;
+    uint64_t e;
+    int bad;
+
+    if (fp == NULL) {
+        perror("tmpfile");
+        exit(1);
+    }
+    out.fp = fp;
+    graph_format = GRAPH_CSR;
+    export_graph(hole);
+    graph_format = 0;
+    out.fp = saved;
+
+    rewind(fp);
+    bad = (fread(buf, 1, 24, fp) != 24 || memcmp(buf, "TRIGRAPH", 8) != 0);
+    while (!bad && fread(buf, 1, 32, fp) == 32) {
+        uint64_t first = get_le(buf + 8, 8);
+        uint64_t nodes = get_le(buf + 16, 8);
+        uint64_t edges = get_le(buf + 24, 8);
+        uint64_t last = 0;
+        uint64_t i;
+
+        bad = (first != (uint64_t)total || targets_end > first + nodes);
+        if (nodes == 0) {
+            break;
+        }
+        if (keep) {
+            positions = graph_grow(positions, (first + nodes) * sizeof(uint64_t));
+            flags = graph_grow(flags, first + nodes);
+            sources = graph_grow(sources, (nedges + edges + 1) * sizeof(uint64_t));
+            targets = graph_grow(targets, (nedges + edges + 1) * sizeof(uint64_t));
+            jumps = graph_grow(jumps, 2 * (nedges + edges + 1));
+            for (i = 0; i < nodes && !bad; i++) {
+                bad = (fread(buf, 1, 8, fp) != 8);
+                positions[first + i] = get_le(buf, 8);
+            }
+            bad = bad || fread(flags + first, 1, nodes, fp) != nodes;
+        } else {
+            fseek(fp, 9 * nodes, SEEK_CUR);
+        }
+        for (i = 0; i <= nodes && !bad; i++) {
+            uint64_t offset = 0;
+
+            bad = (fread(buf, 1, 8, fp) != 8 || (offset = get_le(buf, 8)) < last ||
+                   (i == 0 && offset != 0) || (i == nodes && offset != edges));
+            /* Every edge between the last offset and this one leaves node i - 1 */
+            for (e = last; keep && i > 0 && e < offset && e < edges; e++) {
+                sources[nedges + e] = first + i - 1;
+            }
+            last = offset;
+        }
+        next_first = first + nodes;
+        targets_end = next_first;
+        for (i = 0; i < edges && !bad; i++) {
+            uint64_t target = 0;
+
+            bad = (fread(buf, 1, 8, fp) != 8 || (target = get_le(buf, 8)) < next_first);
+            if (target >= targets_end) {
+                targets_end = target + 1;
+            }
+            if (keep) {
+                targets[nedges + i] = target;
+            }
+        }
+        if (keep) {
+            bad = bad || fread(jumps + 2 * nedges, 1, 2 * edges, fp) != 2 * edges;
+            nedges += edges;
+        } else {
+            fseek(fp, 2 * edges, SEEK_CUR);
+        }
+        total += nodes;
+    }
+    fclose(fp);
+
+    for (e = 0; keep && !bad && e < (uint64_t)total; e++) {
+        bb64 pegs = bb64_zero();
+        int h;
+
+        for (h = 0; h < geom.holes; h++) {
+            if (positions[e] & ((uint64_t)1 << h)) {
+                pegs = bb64_or(pegs, bb64_hole[h]);
+            }
+        }
+        bad = (!(flags[e] & GRAPH_WON) != !winnable(pegs));
+    }
+    for (e = 0; keep && !bad && e < nedges; e++) {
+        int from = jumps[2 * e] - 1;
+        int to = jumps[2 * e + 1] - 1;
+        uint64_t pos = positions[sources[e]];
+        uint64_t over = 0;
+        int k;
+
+        for (k = 0; k < geom.nmoves; k++) {
+            if (geom.moves[k].from == from && geom.moves[k].to == to) {
+                over = (uint64_t)1 << geom.moves[k].over;
+            }
+        }
+        bad = (over == 0 || targets[e] >= (uint64_t)total || !(pos & ((uint64_t)1 << from)) ||
+               !(pos & over) || (pos & ((uint64_t)1 << to)) ||
+               positions[targets[e]] != (pos ^ ((uint64_t)1 << from) ^ over ^ ((uint64_t)1 << to)));
+    }
+    free(positions);
+    free(flags);
+    free(sources);
+    free(targets);
+    free(jumps);
+    return bad ? -1 : total;
+}
+
+/*
+ * Run a breadth-first search (retrograde analysis for NULL) with a
+ * deadline already past, so it stops after one layer, then again to
+ * carry on from the checkpoint that leaves.
+ */
+static long long
+perft_resume(void (*search)(int), int hole)
+{
+    long long won_total = 0;
+    int saved = checkpointing;
+
+    checkpointing = 1;
+    deadline = now();
+    reset_counters();
+    if (search != NULL) {
+        search(hole);
+    } else {
+        retrograde_solve(0);
+        retrograde_free();
+    }
+    deadline = 0;
+    atomic_store(&stopped, 0);
+    resume = 1;
+    reset_counters();
+    if (search != NULL) {
+        search(hole);
+    } else {
+        won_total = retrograde_solve(0);
+        retrograde_free();
+    }
+    resume = 0;
+    checkpointing = saved;
+    return won_total;
+}
+
+int
+perft(void)
+{
+    long long won_total;
+    int failures = 0;
+    int saved_threads = threads;
+    int i;
+
+    pagoda = 0;
+    goal_hole = 0;
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    for (i = 0; i < NUM_PERFT_CASES; i++) {
+        struct perft_case *pc = &perft_cases[i];
+        long long boards;
+        double t;
+
+        init_geometry(pc->side);
+        printf("side %d hole %2d\n", pc->side, pc->hole);
+
+        if (pc->side == DEFAULT_SIDE) {
+            struct board b;
+
+            reset_counters();
+            setup_board(&b, pc->hole - 1);
+            b.hash = board_hash(&b);
+            t = now();
+            generate_boards(&b);
+            t = now() - t;
+            failures += perft_compare("grid", "boards", total_boards, pc->boards, t);
+            failures += perft_compare("grid", "winning", total_winning_boards, pc->winning, -1);
+            free_boards(&b);
+
+            reset_counters();
+            setup_board(&b, pc->hole - 1);
+            b.hash = board_hash(&b);
+            t = now();
+            inplace_boards(&b, count_pegs(&b), board_pegs(&b));
+            t = now() - t;
+            failures += perft_compare("in place", "boards", total_boards, pc->boards, t);
+            failures += perft_compare("in place", "winning", total_winning_boards, pc->winning, -1);
+        }
+
+        if (pc->boards <= PERFT_DFS_LIMIT) {
+            reset_counters();
+            t = now();
+            bitboard_solve(pc->hole - 1);
+            t = now() - t;
+            failures += perft_compare("bitboard", "boards", total_boards, pc->boards, t);
+            failures += perft_compare("bitboard", "winning", total_winning_boards, pc->winning, -1);
+        }
+
+        reset_counters();
+        t = now();
+        parallel_solve(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("parallel", "boards", total_boards, pc->boards, t);
+        failures += perft_compare("parallel", "winning", total_winning_boards, pc->winning, -1);
+
+        symmetry = 1;
+        init_symmetry();
+        reset_counters();
+        t = now();
+        parallel_solve(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("symmetry", "boards", total_boards, pc->boards, t);
+        failures += perft_compare("symmetry", "winning", total_winning_boards, pc->winning, -1);
+        symmetry = 0;
+
+        /* Pruning may only remove lines that can't be won */
+        pagoda = 1;
+        init_pagodas(pc->hole - 1);
+        reset_counters();
+        t = now();
+        parallel_solve(pc->hole - 1);
+        t = now() - t;
+        boards = total_boards;
+        failures += perft_compare("pagoda", "winning", total_winning_boards, pc->winning, t);
+        if (boards > pc->boards) {
+            printf("  pagoda    boards    %18lld             FAILED, more than without pruning\n", boards);
+            failures++;
+        }
+        pagoda = 0;
+        init_pagodas(pc->hole - 1);
+
+        reset_counters();
+        t = now();
+        external_bfs(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("external", "distinct", distinct_boards, pc->distinct, t);
+
+        reset_counters();
+        t = now();
+        dense_bfs(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("dense", "distinct", distinct_boards, pc->distinct, t);
+
+        t = now();
+        won_total = retrograde_solve(0);
+        t = now() - t;
+        failures += perft_compare("retro", "winnable", retrograde_winnable(pc->hole - 1), pc->winning > 0, t);
+        retrograde_free();
+
+        /* Each stopped after a layer and carried on from the checkpoint */
+        t = now();
+        perft_resume(external_bfs, pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("external+", "distinct", distinct_boards, pc->distinct, t);
+
+        t = now();
+        perft_resume(dense_bfs, pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("dense+", "distinct", distinct_boards, pc->distinct, t);
+
+        t = now();
+        boards = perft_resume(NULL, pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("retro+", "won", boards, won_total, t);
+
+        t = now();
+        boards = perft_graph(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("graph", "nodes", boards, pc->distinct, t);
+
+        reset_counters();
+        t = now();
+        outcome_solve(pc->hole - 1);
+        t = now() - t;
+        failures += perft_compare("outcomes", "boards", total_boards, pc->boards, t);
+        failures += perft_compare("outcomes", "winning", total_winning_boards, pc->winning, -1);
+        failures += perft_compare("outcomes", "distinct", distinct_boards, pc->distinct, -1);
+    }
+
+    failures += perft_memory_limit(&perft_cases[NUM_PERFT_CASES - 1]);
+    failures += perft_unjumps();
+#ifdef __AVX2__
+    failures += perft_vector();
+#endif
+    failures += perft_winnable();
+    failures += perft_ranks();
+    failures += perft_retrograde();
+
+    threads = saved_threads;
+    printf("%d cases, %d failures\n", NUM_PERFT_CASES, failures);
+    return failures;
+}
+
+int
+main(int argc, char **argv)
+{
+    int c;
+    double t;
+
+    struct board initial_board_1 = { {
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
+        { _, _, _, _, _, _, X, _, _, _, _, _, _ },
+        { _, _, _, _, _, X, _, X, _, _, _, _, _ },
+        { _, _, _, _, X, _, O, _, X, _, _, _, _ },
+        { _, _, _, X, _, X, _, X, _, X, _, _, _ },
+        { _, _, X, _, X, _, X, _, X, _, X, _, _ },
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ } },
+        { NULL },
+        NULL, 0
+    };
+    struct board initial_board_2 = { {
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
+        { _, _, _, _, _, _, _, _, _, _, _, _, _ },
+        { _, _, _, _, _, _, O, _, _, _, _, _, _ },
+        { _, _, _, _, _, X, _, X, _, _, _, _, _ },
+        { _, _, _, _, X, _, X, _, X, _, _, _, _ },
         { _, _, _, X, _, X, _, X, _, X, _, _, _ },
         { _, _, X, _, X, _, X, _, X, _, X, _, _ },
         { _, _, _, _, _, _, _, _, _, _, _, _, _ },
@@ -304,7 +5735,8 @@ main(int argc, char **argv)
         NULL, 0
     };
 
-    while ((c = getopt(argc, argv, "dv")) != EOF) {
+    out.fp = stdout;
+    while ((c = getopt(argc, argv, "dvWabcrfiIlpxDRPyCB:k:o:M:j:H:s:e:g:m:L:t:u:X:T:")) != EOF) {
         switch (c) {
             case 'd':
                 debug = 1;
@@ -312,30 +5744,335 @@ main(int argc, char **argv)
             case 'v':
                 visual = 1;
                 break;
+            case 'b':
+                bitboard = 1;
+                break;
+            case 'W':
+                write_table = 1;
+                break;
+            case 'a':
+                play = 1;
+                break;
+            case 'f':
+                first_only = 1;
+                break;
+            case 'i':
+                inplace = 1;
+                break;
+            case 'I':
+                batch = 1;
+                break;
+            case 'p':
+                profiling = 1;
+                break;
+            case 'D':
+                dense = 1;
+                break;
+            case 'R':
+                retro = 1;
+                break;
+            case 'l':
+                outcomes = 1;
+                break;
+            case 'c':
+                checkpointing = 1;
+                break;
+            case 'r':
+                checkpointing = 1;
+                resume = 1;
+                break;
+            case 'x':
+                external = 1;
+                break;
+            case 'P':
+                pagoda = 1;
+                break;
+            case 'y':
+                symmetry = 1;
+                break;
+            case 'C':
+                check = 1;
+                break;
+            case 'B':
+                benchmark = atoll(optarg);
+                break;
+            case 'M':
+                playouts = atoll(optarg);
+                break;
+            case 'o':
+                if (strcmp(optarg, "text") == 0) {
+                    output_format = OUTPUT_TEXT;
+                } else if (strcmp(optarg, "json") == 0) {
+                    output_format = OUTPUT_JSON;
+                } else if (strcmp(optarg, "binary") == 0) {
+                    output_format = OUTPUT_BINARY;
+                } else {
+                    usage(argv[0]);
+                    exit(1);
+                }
+                break;
+            case 'k':
+                max_solutions = atoll(optarg);
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
+            case 'H':
+                hash_size = atoll(optarg) << 20;
+                break;
+            case 's':
+                side = atoi(optarg);
+                break;
+            case 'm':
+                memory_budget = atoll(optarg) << 20;
+                break;
+            case 't':
+                time_limit = atof(optarg);
+                break;
+            case 'u':
+                report_interval = atof(optarg);
+                break;
+            case 'X':
+                if (strcmp(optarg, "dot") == 0) {
+                    graph_format = GRAPH_DOT;
+                } else if (strcmp(optarg, "csr") == 0) {
+                    graph_format = GRAPH_CSR;
+                } else {
+                    usage(argv[0]);
+                    exit(1);
+                }
+                break;
+            case 'L':
+                memory_limit = atoll(optarg) << 20;
+                break;
+            case 'T':
+                spill_dir = optarg;
+                break;
+            case 'e':
+                start_hole = atoi(optarg);
+                break;
+            case 'g':
+                goal_hole = atoi(optarg);
+                break;
             default:
                 usage(argv[0]);
                 exit(1);
         }
     }
 
-    if (visual && !debug) {
+    if (profiling) {
+        profile_init();
+    }
+    if (side < 1 || side > MAX_SIDE) {
+        fprintf(stderr, "%s: side must be between 1 and %d\n", argv[0], MAX_SIDE);
+        exit(1);
+    }
+    if (write_table && side != WINNABLE15_SIDE) {
+        fprintf(stderr, "%s: -W only writes the table for side %d\n", argv[0], WINNABLE15_SIDE);
+        exit(1);
+    }
+    init_geometry(side);
+    init_zobrist();
+    init_binomial();
+    init_symmetry();
+    if (start_hole < 1 || start_hole > geom.holes || goal_hole < 0 || goal_hole > geom.holes) {
+        fprintf(stderr, "%s: hole must be between 1 and %d\n", argv[0], geom.holes);
+        exit(1);
+    }
+    if (max_solutions < 0) {
+        fprintf(stderr, "%s: can't keep a negative number of winning lines\n", argv[0]);
+        exit(1);
+    }
+    if (threads < 0 || threads > MAX_THREADS) {
+        fprintf(stderr, "%s: threads must be between 0 and %d (0 for no threads)\n", argv[0], MAX_THREADS);
+        exit(1);
+    }
+    if (symmetry && (pagoda || goal_hole)) {
+        fprintf(stderr, "%s: -y can't be used with -P or -g\n", argv[0]);
+        exit(1);
+    }
+    if (batch && pagoda) {
+        fprintf(stderr, "%s: -P prunes by the starting hole, so can't be used with -I\n", argv[0]);
+        exit(1);
+    }
+    if ((symmetry || batch) && threads == 0) {
+        threads = 1;
+    }
+    if (first_only && (threads > 0 || external || dense || batch)) {
+        fprintf(stderr, "%s: -f can't be used with -j, -y, -x, -D or -I\n", argv[0]);
+        exit(1);
+    }
+    if (checkpointing && !(external || dense || retro)) {
+        fprintf(stderr, "%s: -c and -r only apply to -x, -D and -R\n", argv[0]);
+        exit(1);
+    }
+    if (side != DEFAULT_SIDE || threads > 0 || first_only) {
+        bitboard = 1;
+    }
+    if (pagoda) {
+        init_pagodas(start_hole - 1);
+        if (!bitboard) {
+            bb64_init();
+        }
+    }
+
+    if (report_interval > 0 && (check || write_table || benchmark > 0 || play || playouts > 0)) {
+        fprintf(stderr, "%s: -u only applies to searches, not -C, -W, -B, -a or -M\n", argv[0]);
+        exit(1);
+    }
+    /* Only the searches have anything to say on SIGUSR1; the rest ignore it */
+    signal(SIGUSR1, SIG_IGN);
+
+    reserve_solution();
+
+    profile_phase("setup", 0);
+    if (profiling) {
+        atexit(profile_finish);
+    }
+
+    if (check) {
+        return perft() == 0 ? 0 : 1;
+    }
+    if (write_table) {
+        write_winnable_header();
+        return 0;
+    }
+    if (benchmark > 0) {
+        benchmark_symmetry(benchmark);
+        return 0;
+    }
+    if (play) {
+        play_game(start_hole - 1);
+        return 0;
+    }
+    if (batch) {
+        search_start = now();
+        progress_start();
+        batch_solve();
+        progress_stop();
+        profile_phase("search", tt_totals.hits + tt_totals.misses);
+        return 0;
+    }
+
+    if (visual && !debug && output_format == OUTPUT_TEXT) {
         CLEAR_SCREEN;
         CURSOR_HOME;
     }
 
-    generate_boards(&initial_board_1);
+    if (playouts > 0) {
+        monte_carlo(start_hole - 1);
+        profile_phase("search", playouts);
+        return 0;
+    }
+
+    t = now();
+    search_start = t;
+    if (time_limit > 0) {
+        deadline = t + time_limit;
+    }
+    if (time_limit > 0 || checkpointing) {
+        /* Ctrl-C stops the search as the deadline would, and with -c it can be resumed */
+        signal(SIGINT, stop_search);
+    }
+    progress_start();
+    if (retro) {
+        retrograde();
+        progress_stop();
+        return 0;
+    }
+    if (graph_format) {
+        export_graph(start_hole - 1);
+        progress_stop();
+        return 0;
+    }
+    if (outcomes) {
+        outcome_report(start_hole - 1);
+        progress_stop();
+        return 0;
+    }
+    if (external || dense) {
+        if (dense) {
+            dense_bfs(start_hole - 1);
+        } else {
+            external_bfs(start_hole - 1);
+        }
+        progress_stop();
+        profile_phase("search", distinct_boards);
+        if (output_format != OUTPUT_TEXT) {
+            write_result(start_hole - 1, distinct_boards, RECORD_DISTINCT, now() - t);
+            return 0;
+        }
+
+        if (atomic_load(&stopped)) {
+            printf("Stopped after %.2fs; the counts are of the layers finished by then%s\n", now() - t,
+                   checkpointing ? ", run again with -r to carry on" : "");
+        }
+        printf("Distinct boards: %lld\n", distinct_boards);
+        printf("Winning boards: %lld\n", total_winning_boards);
+        print_memory();
+        return 0;
+    }
 
-    printf("Total boards: %d\n", total_boards);
+    if (bitboard) {
+        if (first_only && use_winnable_table()) {
+            table_solution(start_hole - 1);
+        } else if (threads > 0) {
+            parallel_solve(start_hole - 1);
+        } else {
+            bitboard_solve(start_hole - 1);
+        }
+        progress_stop();
+        profile_phase("search", threads > 0 ? tt_totals.hits + tt_totals.misses : total_boards);
+        if (output_format != OUTPUT_TEXT) {
+            write_result(start_hole - 1, total_boards, 0, now() - t);
+            return 0;
+        }
 
-    if (total_winning_boards > 0) {
-        struct board *b = winning_board;
-        while (b->prev != NULL) {
-            b->prev->nextwin = b;
-            b = b->prev;
+        printf("Total boards: %lld\n", total_boards);
+        if (table_lookups > 0) {
+            printf("Table lookups: %lld\n", table_lookups);
         }
-        while (b != NULL) {
-            print_board(b);
-            b = b->nextwin;
+        if (pagoda || goal_hole) {
+            printf("Winning boards: %lld\n", total_winning_boards);
         }
+        if (pagoda) {
+            printf("Pagoda cuts: %lld\n", pagoda_cuts);
+        }
+        if (threads > 0) {
+            printf("Hash table: %zu entries, %lld hits, %lld misses, %lld collisions, %lld replaced\n",
+                   tt_mask + 1, tt_totals.hits, tt_totals.misses, tt_totals.collisions, tt_totals.replaced);
+        }
+        print_memory();
+
+        print_solutions(start_hole - 1);
+        return 0;
+    }
+
+    if (start_hole != DEFAULT_HOLE) {
+        setup_board(&initial_board_1, start_hole - 1);
+    }
+    initial_board_1.hash = board_hash(&initial_board_1);
+    if (inplace) {
+        clear_last(&initial_board_1);
+        inplace_boards(&initial_board_1, count_pegs(&initial_board_1), board_pegs(&initial_board_1));
+    } else {
+        generate_boards(&initial_board_1);
+    }
+    progress_stop();
+    profile_phase("search", total_boards);
+    if (output_format != OUTPUT_TEXT) {
+        write_result(start_hole - 1, total_boards, 0, now() - t);
+        return 0;
     }
+
+    printf("Total boards: %lld\n", total_boards);
+    if (pagoda || goal_hole) {
+        printf("Winning boards: %lld\n", total_winning_boards);
+    }
+    if (pagoda) {
+        printf("Pagoda cuts: %lld\n", pagoda_cuts);
+    }
+    print_memory();
+
+    print_solutions(start_hole - 1);
 }
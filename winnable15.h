@@ -0,0 +1,267 @@
+/*
+ * Generated by "tri_solitaire -W > winnable15.h"; do not edit.
+ *
+ * Bit p % 8 of byte p / 8 is set if position p of the 15-hole board,
+ * with hole h as bit h - 1, can be cut down to a single peg.
+ */
+#define WINNABLE15_SIDE  5
+#define WINNABLE15_BYTES 4096
+
+static const unsigned char winnable15[WINNABLE15_BYTES] = {
+    0x3e, 0x45, 0xbd, 0xd1, 0x51, 0x00, 0xc5, 0x7c, 0x09, 0x03, 0x38, 0xe3, 0xc0, 0x10, 0xdb, 0xb5,
+    0x09, 0x85, 0xa7, 0x5c, 0x40, 0x44, 0xbd, 0xc8, 0x21, 0x42, 0x9b, 0xbd, 0x91, 0x50, 0x7e, 0xe7,
+    0x21, 0x40, 0x9b, 0xbd, 0x91, 0x50, 0x74, 0xe0, 0x00, 0x00, 0x82, 0x7e, 0x10, 0x20, 0xb8, 0xd1,
+    0xa9, 0xd3, 0x3e, 0xe7, 0xc7, 0x7c, 0xdb, 0xbd, 0x28, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x21, 0xc0, 0x2c, 0xe7, 0x03, 0x04, 0xcb, 0x9d, 0x00, 0x00, 0xbc, 0xdb, 0x00, 0x00, 0xe7, 0x7e,
+    0x00, 0x04, 0x82, 0xac, 0x00, 0x08, 0x7e, 0xc5, 0x09, 0x85, 0xa7, 0x7e, 0x42, 0x44, 0xbd, 0xdb,
+    0x09, 0x85, 0xa7, 0x7e, 0x42, 0x44, 0xbd, 0xdb, 0x21, 0x42, 0x9b, 0xbd, 0x91, 0x50, 0x7e, 0xe7,
+    0x28, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e, 0xa8, 0xdb, 0x3e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x01, 0x04, 0x80, 0x44, 0x00, 0x00, 0x04, 0xc0, 0x45, 0x00, 0xd1, 0x20, 0x00, 0x00, 0x7c, 0x41,
+    0x00, 0x04, 0x85, 0x40, 0x00, 0x00, 0x04, 0x40, 0x85, 0x00, 0x5c, 0xe5, 0x44, 0x40, 0xd8, 0x85,
+    0x00, 0x00, 0x58, 0xc5, 0x00, 0x40, 0x50, 0x80, 0x40, 0x00, 0xbd, 0x52, 0x50, 0x00, 0xe0, 0x50,
+    0xc5, 0x4c, 0xd9, 0xad, 0x04, 0xc0, 0x7c, 0xc5, 0xdb, 0x35, 0xe7, 0x7e, 0x7c, 0xc1, 0xbd, 0xd3,
+    0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x08, 0x44, 0xc0, 0x00, 0xe7, 0x44, 0x04, 0x00, 0x9d, 0x02,
+    0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 0xad, 0xc8, 0x08, 0x00, 0xc5, 0x4e,
+    0x00, 0x04, 0xa5, 0xc8, 0x00, 0x00, 0xc5, 0x4c, 0x85, 0x00, 0x7e, 0xe5, 0x44, 0x40, 0xdb, 0xb5,
+    0xc0, 0x8c, 0xe7, 0x4c, 0x0c, 0x44, 0x9d, 0xca, 0xe7, 0x7c, 0xdb, 0xbd, 0x9d, 0xc3, 0x7e, 0xe7,
+    0x01, 0x00, 0xd0, 0x90, 0x00, 0x00, 0x54, 0xc4, 0x08, 0x01, 0xa0, 0x74, 0x40, 0x00, 0xbd, 0xd1,
+    0xbd, 0xd1, 0x6c, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x38, 0xe7, 0xb8, 0xdb, 0xdb, 0xb5, 0xe7, 0x7c,
+    0x20, 0xc0, 0xb8, 0xd9, 0xd1, 0x14, 0xc4, 0x74, 0xa8, 0x51, 0x2a, 0xe7, 0xc5, 0x70, 0xd9, 0xbd,
+    0x9b, 0xbd, 0xe7, 0x7c, 0x7c, 0xe5, 0xbd, 0xdb, 0xa2, 0x7e, 0xda, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x00, 0x00, 0xe4, 0x74, 0x00, 0x00, 0xbd, 0xd9, 0x00, 0x00, 0xd8, 0xbd, 0x00, 0x00, 0x7e, 0xe7,
+    0x2c, 0xe7, 0xac, 0xcb, 0xcb, 0x9d, 0xe7, 0x5c, 0xbd, 0xdb, 0x7c, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x7c, 0xe7, 0xe7, 0x7c, 0xdb, 0xbd, 0x38, 0xe7, 0xb8, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0xa7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7, 0x9b, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x01, 0x00, 0x54, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8, 0x51, 0x00, 0x00, 0xc4, 0x70,
+    0xc5, 0x4c, 0xd1, 0x8c, 0x04, 0xc0, 0x7c, 0xc4, 0xdb, 0x35, 0xe7, 0x7c, 0x7c, 0xc1, 0xbd, 0xdb,
+    0x51, 0x00, 0xc5, 0x7c, 0x70, 0xc0, 0xb0, 0xd0, 0xc0, 0x10, 0xdb, 0xb5, 0xb4, 0x50, 0x74, 0xe0,
+    0x58, 0xe5, 0xbd, 0xdb, 0x58, 0x85, 0xe7, 0x7c, 0xbd, 0xd3, 0x7e, 0xe7, 0xe5, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0xc5, 0x4c, 0x00, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xdb, 0x35,
+    0xc0, 0x8c, 0xe7, 0x4c, 0x0c, 0x44, 0x9d, 0xc8, 0xe7, 0x7c, 0xdb, 0xbd, 0x9d, 0xc3, 0x7e, 0xe7,
+    0xe7, 0x4c, 0xdb, 0xbd, 0x15, 0xc0, 0x7c, 0xe7, 0xdb, 0x35, 0xe7, 0x7e, 0x7c, 0xc1, 0xbd, 0xdb,
+    0xa5, 0xc8, 0x7e, 0xe7, 0xc5, 0x4e, 0xdb, 0xbd, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x01, 0x00, 0x54, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8, 0x51, 0x00, 0x00, 0xc0, 0x70,
+    0x45, 0x4c, 0xd1, 0x8c, 0x00, 0xc0, 0x7c, 0xc4, 0xdb, 0x15, 0xe7, 0x7c, 0x70, 0xc0, 0xbd, 0xd3,
+    0x51, 0x00, 0xc5, 0x7c, 0x70, 0xc0, 0xb0, 0xd0, 0xc0, 0x10, 0xdb, 0xb5, 0xb0, 0x50, 0x70, 0xe0,
+    0x40, 0x44, 0xbd, 0xdb, 0x50, 0x80, 0xe7, 0x7c, 0x91, 0x50, 0x7e, 0xe7, 0xa0, 0x50, 0xdb, 0xb5,
+    0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0x45, 0x4c, 0x00, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xdb, 0x15,
+    0xc0, 0x8c, 0xe7, 0x4c, 0x04, 0x44, 0x9d, 0xc8, 0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7e, 0xe7,
+    0xe7, 0x4c, 0xdb, 0xbd, 0x15, 0xc0, 0x7c, 0xc7, 0xdb, 0x35, 0xe7, 0x7e, 0x7c, 0xc1, 0xbd, 0xdb,
+    0x85, 0x88, 0x7e, 0xe7, 0x44, 0x44, 0xdb, 0x9d, 0x6a, 0xe5, 0xbd, 0xdb, 0xd9, 0x15, 0xe7, 0x7e,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x04, 0x00, 0x44, 0x84, 0x00, 0x00, 0xc0, 0x04, 0x4c, 0x01, 0xad, 0xd1, 0xc0, 0x00, 0xc5, 0x70,
+    0x00, 0x00, 0x05, 0xc0, 0x40, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x7c, 0xc1, 0xc0, 0x10, 0xd0, 0x30,
+    0x00, 0x00, 0xe5, 0x5c, 0x40, 0x00, 0x85, 0xd0, 0x44, 0x40, 0xdb, 0xb5, 0x80, 0x10, 0x7c, 0xe1,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x24, 0x00, 0x00, 0x4c, 0x01,
+    0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x44, 0x08, 0x8c, 0x00, 0x4c, 0xe7, 0x44, 0x00, 0xca, 0x1d,
+    0x04, 0x00, 0x4c, 0xc4, 0x00, 0x00, 0xc0, 0x0c, 0x4c, 0x01, 0xbd, 0xd3, 0xc0, 0x00, 0xc7, 0x7c,
+    0x04, 0x00, 0xc8, 0xad, 0x00, 0x00, 0x4e, 0xc5, 0x88, 0x81, 0xe7, 0x7e, 0x44, 0x04, 0xbd, 0xdb,
+    0x01, 0x04, 0xc4, 0x54, 0x00, 0x00, 0x84, 0xd0, 0x45, 0x00, 0xd9, 0xbd, 0x00, 0x00, 0x7c, 0xe5,
+    0x5c, 0xc5, 0xbd, 0xd0, 0xc0, 0x14, 0xe5, 0x5c, 0xbd, 0xdb, 0x7c, 0xe7, 0xc5, 0x7c, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x7c, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x78, 0xe3, 0xbd, 0xdb, 0xdb, 0xb5, 0xe3, 0x74,
+    0xe7, 0x7c, 0xdb, 0xbd, 0xbd, 0xd9, 0x7c, 0xe7, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x20, 0x40, 0xc8, 0xbd, 0x01, 0x00, 0x5c, 0xc5, 0xc0, 0x00, 0xe7, 0x7e, 0x04, 0x00, 0xbd, 0xdb,
+    0xac, 0xd1, 0x7e, 0xe5, 0x45, 0x4c, 0xdb, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e,
+    0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7c, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x00, 0x00, 0x80, 0x50, 0x00, 0x00, 0x04, 0x40, 0x04, 0x00, 0x54, 0xe0, 0x00, 0x00, 0xd8, 0x85,
+    0x48, 0x85, 0xe5, 0x54, 0x40, 0x44, 0x95, 0xc8, 0xe5, 0x56, 0xd9, 0xbd, 0x95, 0xd0, 0x7e, 0xe5,
+    0xa0, 0x44, 0xd8, 0x95, 0x85, 0xd0, 0x54, 0xe0, 0xd1, 0x20, 0xc5, 0x7e, 0x7c, 0x61, 0xbc, 0xd1,
+    0xad, 0xd1, 0x7e, 0xe5, 0xc5, 0x7c, 0xd9, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x48, 0x85, 0x40, 0x00, 0xbd, 0xd8, 0x00, 0x00, 0xe5, 0x5e,
+    0x80, 0x44, 0xd1, 0xac, 0x04, 0x08, 0x4e, 0xc5, 0xd9, 0xad, 0xe7, 0x7e, 0x4e, 0x45, 0xbd, 0xdb,
+    0x48, 0x8d, 0xe5, 0x7e, 0x4a, 0x44, 0xbd, 0xd9, 0xe7, 0x56, 0xdb, 0xbd, 0x9d, 0xd2, 0x7e, 0xe7,
+    0x4c, 0xe7, 0xbd, 0xdb, 0xca, 0x9d, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x01, 0x00, 0xc4, 0x54, 0x00, 0x00, 0x84, 0xd0, 0x00, 0x00, 0xd8, 0xbd, 0x00, 0x00, 0x5c, 0xe5,
+    0x08, 0xc5, 0xac, 0xd0, 0xc0, 0x14, 0xe5, 0x5c, 0xbd, 0xdb, 0x7c, 0xe7, 0xc5, 0x7c, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x78, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x38, 0xe3, 0xb8, 0xdb, 0xdb, 0xb5, 0xe3, 0x74,
+    0xa7, 0x7c, 0xdb, 0xbd, 0xbd, 0xd9, 0x7c, 0xe7, 0x9b, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x20, 0x40, 0x88, 0xbd, 0x01, 0x00, 0x5c, 0xc5, 0x00, 0x00, 0xe4, 0x7e, 0x00, 0x00, 0xbd, 0xdb,
+    0xa8, 0xd1, 0x2a, 0xe5, 0x45, 0x4c, 0xdb, 0xbd, 0x2c, 0xe7, 0xac, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e,
+    0x2c, 0xe7, 0xac, 0xdb, 0xdb, 0x9d, 0xe7, 0x7c, 0xbd, 0xdb, 0x7c, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x8a, 0xbd, 0xe6, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb, 0xa7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x00, 0x00, 0x80, 0x50, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x54, 0xe0, 0x00, 0x00, 0xd8, 0x85,
+    0x08, 0x85, 0xa5, 0x54, 0x40, 0x44, 0x95, 0xc8, 0xe5, 0x46, 0xd8, 0xbd, 0x95, 0xd0, 0x5e, 0xe5,
+    0xa0, 0x44, 0xd8, 0x95, 0x85, 0xd0, 0x54, 0xe0, 0xd1, 0x20, 0xc5, 0x7e, 0x7c, 0x61, 0xbc, 0xd1,
+    0xad, 0xd1, 0x7e, 0xe5, 0xc5, 0x7c, 0xd9, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x48, 0x85, 0x40, 0x00, 0xbd, 0xd8, 0x00, 0x00, 0xe5, 0x5e,
+    0x80, 0x44, 0xd1, 0xac, 0x04, 0x08, 0x4e, 0xc5, 0xd9, 0xad, 0xe5, 0x7e, 0x4e, 0x45, 0xbd, 0xdb,
+    0x08, 0x8d, 0xa5, 0x7e, 0x4a, 0x44, 0xbd, 0xd9, 0xe7, 0x46, 0xdb, 0xbd, 0x9d, 0xd2, 0x7e, 0xe7,
+    0x48, 0xe7, 0xbd, 0xdb, 0xca, 0x9d, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0x40, 0xc0, 0x00, 0x00, 0xc0, 0x14, 0x08, 0x01, 0xa0, 0xd0, 0xc0, 0x10, 0xc5, 0x74,
+    0xc4, 0x54, 0xc0, 0x84, 0x84, 0xd0, 0x74, 0xc4, 0xd8, 0xbd, 0xe0, 0x7c, 0x5c, 0xe5, 0xbd, 0xd9,
+    0xd0, 0x90, 0xc0, 0x5c, 0x54, 0xc4, 0x90, 0xd0, 0xa0, 0x74, 0x8a, 0xbd, 0xbd, 0xd1, 0x74, 0xe4,
+    0x7c, 0xe5, 0xbd, 0xd9, 0xd9, 0xbd, 0xe5, 0x7c, 0xb8, 0xdb, 0x7a, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x20, 0xc0, 0x88, 0xd1, 0x01, 0x04, 0xc4, 0x5c, 0xa8, 0x51, 0x68, 0xe7, 0x45, 0x00, 0xdb, 0xbd,
+    0x88, 0xbd, 0xa2, 0x5c, 0x5c, 0xc5, 0xbd, 0xd8, 0xe4, 0x7e, 0xca, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0xe4, 0x74, 0xc8, 0xbd, 0xbd, 0xd9, 0x7c, 0xe5, 0xd8, 0xbd, 0xe2, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0xac, 0xdb, 0x6e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x01, 0x00, 0xd0, 0x90, 0x10, 0x00, 0x54, 0xc4, 0x08, 0x01, 0xe0, 0x74, 0x40, 0x00, 0xbd, 0xd1,
+    0xbd, 0xd1, 0x7c, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7c,
+    0x74, 0xc0, 0xbd, 0xd9, 0xd1, 0x14, 0xc4, 0x74, 0xb8, 0x51, 0x7e, 0xe7, 0xc5, 0x70, 0xd9, 0xbd,
+    0xdb, 0xbd, 0xe7, 0x7c, 0x7c, 0xe5, 0xbd, 0xdb, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x51, 0x00, 0xe5, 0x7c, 0x00, 0x00, 0xbd, 0xd9, 0xc0, 0x10, 0xdb, 0xbd, 0x04, 0x00, 0x7e, 0xe7,
+    0x6c, 0xe7, 0xbd, 0xcb, 0xcb, 0x9d, 0xe7, 0x5c, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x7c, 0xe7, 0xe7, 0x7c, 0xdb, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x01, 0x00, 0xd0, 0x90, 0x10, 0x00, 0x54, 0xc4, 0x08, 0x01, 0xe0, 0x74, 0x40, 0x00, 0xbd, 0xd1,
+    0xbd, 0xd1, 0x7c, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7c,
+    0x74, 0xc0, 0xbd, 0xd9, 0xd1, 0x14, 0xc4, 0x74, 0xb8, 0x51, 0x7e, 0xe7, 0xc5, 0x70, 0xd9, 0xbd,
+    0xdb, 0xbd, 0xe7, 0x7c, 0x7c, 0xe5, 0xbd, 0xdb, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x51, 0x00, 0xe5, 0x7c, 0x00, 0x00, 0xbd, 0xd9, 0xc0, 0x10, 0xdb, 0xbd, 0x00, 0x00, 0x7e, 0xe7,
+    0x6c, 0xe7, 0xbd, 0xcb, 0xcb, 0x9d, 0xe7, 0x5c, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x7c, 0xe7, 0xe7, 0x7c, 0xdb, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x01, 0x00, 0x54, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8, 0x51, 0x00, 0x00, 0xc4, 0x70,
+    0xc5, 0x4c, 0xd1, 0x8c, 0x04, 0xc0, 0x7c, 0xc4, 0xdb, 0x35, 0xe7, 0x7c, 0x7c, 0xc1, 0xbd, 0xdb,
+    0x51, 0x00, 0xc5, 0x7c, 0x70, 0xc0, 0xb0, 0xd0, 0xc0, 0x10, 0xdb, 0xb5, 0xb4, 0x50, 0x74, 0xe0,
+    0x5c, 0xe5, 0xbd, 0xdb, 0xd8, 0x85, 0xe7, 0x7c, 0xbd, 0xd3, 0x7e, 0xe7, 0xe5, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0xac, 0xc0, 0x00, 0x00, 0xc5, 0x4c, 0x00, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xdb, 0x35,
+    0xc0, 0x8c, 0xe7, 0x4c, 0x0c, 0x44, 0x9d, 0xc8, 0xe7, 0x7c, 0xdb, 0xbd, 0x9d, 0xc3, 0x7e, 0xe7,
+    0xe7, 0x4c, 0xdb, 0xbd, 0x15, 0xc0, 0x7c, 0xe7, 0xdb, 0x35, 0xe7, 0x7e, 0x7c, 0xc1, 0xbd, 0xdb,
+    0xad, 0xc8, 0x7e, 0xe7, 0xc5, 0x4e, 0xdb, 0xbd, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x00, 0x00, 0x80, 0x50, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x54, 0xe4, 0x00, 0x00, 0xd8, 0x95,
+    0xd8, 0x95, 0xe5, 0x54, 0x54, 0xc4, 0x95, 0xd8, 0xe5, 0x76, 0xd9, 0xbd, 0xbd, 0xd1, 0x7e, 0xe5,
+    0xe4, 0x54, 0xd9, 0x95, 0x95, 0xd0, 0x54, 0xe4, 0xd9, 0xbd, 0xe5, 0x7e, 0x7c, 0xe5, 0xbd, 0xd1,
+    0xbd, 0xd9, 0x7e, 0xe5, 0xe5, 0x7c, 0xd9, 0xbd, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x00, 0x00, 0x54, 0xe4, 0x00, 0x00, 0xd8, 0x95, 0x40, 0x00, 0xbd, 0xd9, 0x00, 0x00, 0xe5, 0x7e,
+    0xe5, 0x7c, 0xd9, 0xbd, 0xbd, 0xd9, 0x7e, 0xc5, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0xd9, 0xbd, 0xe5, 0x7e, 0x5e, 0xc5, 0xbd, 0xd9, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x90, 0x00, 0x00, 0x40, 0x44,
+    0x54, 0xc4, 0x95, 0xc0, 0xc0, 0x00, 0xc4, 0x54, 0xbd, 0x51, 0x7c, 0xe5, 0xc4, 0x70, 0xd9, 0xb5,
+    0x90, 0x50, 0x54, 0xc4, 0x44, 0x40, 0xd0, 0x90, 0x54, 0xe0, 0xbd, 0xd9, 0xd8, 0x95, 0xe4, 0x70,
+    0xe5, 0x7c, 0xd9, 0xbd, 0xb5, 0xd8, 0x7c, 0xe4, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe5, 0xbd, 0xdb,
+    0x00, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x54, 0xc4, 0x00, 0x00, 0xe4, 0x74, 0x00, 0x00, 0xbd, 0xd9,
+    0xac, 0xc0, 0x7c, 0xc5, 0xc5, 0x4c, 0xd9, 0x8c, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x74, 0xe4, 0xbd, 0xd9, 0xc9, 0x85, 0xe5, 0x7c, 0xbd, 0xd9, 0x7e, 0xe7, 0xe5, 0x7e, 0xdb, 0xbd,
+    0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x01, 0x00, 0x80, 0x10, 0x10, 0x00, 0x50, 0xc0, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xb0, 0x50,
+    0x00, 0x00, 0x64, 0x44, 0x00, 0x40, 0xd1, 0x80, 0x00, 0x00, 0x99, 0xd1, 0x10, 0x00, 0xe0, 0x70,
+    0x00, 0x00, 0x91, 0x10, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x90, 0x10,
+    0xd1, 0x10, 0xe5, 0x7c, 0x70, 0xc0, 0xb9, 0xd1, 0xc0, 0x30, 0xdb, 0xb5, 0xb0, 0x50, 0x70, 0xe2,
+    0x51, 0x00, 0xc5, 0x7c, 0x00, 0x00, 0x08, 0x41, 0xc0, 0x10, 0xdb, 0xb5, 0x00, 0x00, 0x50, 0x02,
+    0x40, 0x44, 0xbd, 0xc8, 0x00, 0x00, 0x46, 0x44, 0x91, 0x50, 0x7e, 0xe7, 0x00, 0x40, 0xd9, 0x9d,
+    0x91, 0x50, 0x74, 0xe4, 0x00, 0x40, 0xd9, 0x91, 0x10, 0x20, 0xb9, 0xd1, 0x10, 0x00, 0xe0, 0x72,
+    0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7e, 0xc7, 0xdb, 0xb5, 0xe7, 0x7e, 0x7c, 0xc3, 0xbd, 0xdb,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xc0, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x44, 0x40, 0x40, 0x00, 0x80, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x40, 0x14, 0xc0, 0x40, 0x00, 0xc0, 0x54, 0x10, 0x00, 0x7c, 0xc1, 0xc0, 0x10, 0xd1, 0x30,
+    0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7c, 0x41, 0x00, 0x00, 0x41, 0x00,
+    0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0xd8, 0x85, 0x00, 0x00, 0x44, 0x44,
+    0x00, 0x40, 0x50, 0x80, 0x00, 0x00, 0x40, 0x44, 0x50, 0x00, 0xe4, 0x50, 0x40, 0x00, 0x91, 0x50,
+    0x04, 0xc0, 0x7c, 0xc5, 0x00, 0x04, 0xc1, 0x0c, 0x7c, 0xc1, 0xbd, 0xd3, 0xc1, 0x00, 0xc7, 0x7c,
+    0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xd8, 0x91,
+    0x88, 0x91, 0xe4, 0x54, 0x50, 0xc4, 0x95, 0xc8, 0x20, 0x62, 0x99, 0xbd, 0xb1, 0x50, 0x7e, 0xe5,
+    0x20, 0x40, 0x99, 0x95, 0x91, 0x50, 0x54, 0xe0, 0x80, 0x10, 0xc5, 0x72, 0x50, 0x20, 0xb8, 0xd1,
+    0xb9, 0xd1, 0x7e, 0xe5, 0xc5, 0x7c, 0xd9, 0xbd, 0x60, 0xe2, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x00, 0x00, 0x54, 0xe4, 0x00, 0x00, 0xc8, 0x91, 0x40, 0x00, 0xbd, 0xd9, 0x00, 0x00, 0xe4, 0x76,
+    0xc5, 0x7c, 0xd1, 0xbc, 0x08, 0x49, 0x7e, 0xc5, 0xdb, 0xb5, 0xe7, 0x7e, 0x52, 0xc6, 0xbd, 0xdb,
+    0xd9, 0x95, 0xe4, 0x76, 0x52, 0xc4, 0xbd, 0xd9, 0xe5, 0x72, 0xd9, 0xbd, 0xb9, 0x51, 0x7e, 0xe7,
+    0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x44, 0x91, 0xc0, 0x40, 0x00, 0xc4, 0x40, 0x91, 0x00, 0x74, 0xe4, 0xc4, 0x50, 0xd8, 0xb5,
+    0x10, 0x00, 0x50, 0xc4, 0x00, 0x40, 0xd0, 0x90, 0x40, 0x00, 0xb5, 0x50, 0x50, 0x00, 0xe0, 0x70,
+    0x80, 0x44, 0xd9, 0x95, 0x84, 0xd0, 0x74, 0xc4, 0xd1, 0x30, 0xe5, 0x7e, 0x7c, 0xe1, 0xbd, 0xd1,
+    0x00, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0xe4, 0x70, 0x00, 0x00, 0x99, 0x41,
+    0x04, 0xc0, 0x7c, 0xc4, 0x00, 0x04, 0xc9, 0x0c, 0x7c, 0xc5, 0xbd, 0xdb, 0x49, 0x00, 0xc7, 0x7e,
+    0x70, 0xc4, 0xb9, 0xd9, 0x41, 0x00, 0xc5, 0x4c, 0xb5, 0x50, 0x76, 0xe6, 0xc4, 0x50, 0xdb, 0xb5,
+    0x58, 0x8d, 0xe7, 0x7c, 0x48, 0x44, 0x9d, 0xd9, 0xe7, 0x7e, 0xdb, 0xbd, 0x9d, 0xd3, 0x7e, 0xe7,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x11, 0xc0, 0x00, 0x00, 0xc0, 0x40, 0x10, 0x00, 0x70, 0xc0, 0x00, 0x00, 0xd0, 0x30,
+    0x10, 0x00, 0x50, 0xc0, 0x00, 0x00, 0x90, 0x10, 0x00, 0x00, 0xb0, 0x50, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x40, 0xd9, 0x91, 0x00, 0x00, 0x74, 0xc4, 0x10, 0x00, 0xe0, 0x72, 0x00, 0x00, 0xb9, 0xd1,
+    0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0xc0, 0x70, 0x00, 0x00, 0x18, 0x01,
+    0x00, 0xc0, 0x7c, 0xc4, 0x00, 0x04, 0xc1, 0x0c, 0x70, 0xc0, 0xbd, 0xd3, 0x01, 0x00, 0xc7, 0x7c,
+    0x70, 0xc0, 0xb9, 0xd1, 0x01, 0x00, 0xc5, 0x4c, 0xb0, 0x50, 0x70, 0xe2, 0x00, 0x00, 0xdb, 0x35,
+    0x50, 0x80, 0xe7, 0x7c, 0x40, 0x04, 0x9d, 0xc9, 0xa0, 0x50, 0xdb, 0xbd, 0x81, 0x10, 0x7e, 0xe7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x50, 0x40,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x91, 0x50, 0x00, 0x00, 0xc4, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x04, 0x00, 0xc0, 0x00, 0xc5, 0x74, 0x04, 0x00, 0x0c, 0x41,
+    0x40, 0x00, 0xc0, 0x44, 0x00, 0x00, 0x04, 0x40, 0xc0, 0x10, 0xd1, 0x30, 0x00, 0x00, 0x5c, 0x41,
+    0x40, 0x00, 0x85, 0xd0, 0x00, 0x00, 0x44, 0x44, 0x80, 0x10, 0x7c, 0xe5, 0x04, 0x00, 0xd9, 0x15,
+    0x01, 0x00, 0x54, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8, 0xd1, 0x00, 0x00, 0xc0, 0x70,
+    0x45, 0x4c, 0xd1, 0x8c, 0x00, 0xc0, 0x7c, 0xc4, 0xdb, 0x15, 0xe7, 0x7c, 0x70, 0xc0, 0xbd, 0xdb,
+    0xd1, 0x10, 0xc5, 0x7c, 0x70, 0xc0, 0xb0, 0xd0, 0xc0, 0x30, 0xdb, 0xb5, 0xb0, 0x50, 0x70, 0xe0,
+    0x74, 0xe4, 0xbd, 0xdb, 0xd9, 0x91, 0xe7, 0x7c, 0xb9, 0xd1, 0x7e, 0xe7, 0xe0, 0x72, 0xdb, 0xbd,
+    0x00, 0x00, 0xac, 0xd0, 0x00, 0x00, 0x45, 0x4c, 0x00, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xdb, 0x1d,
+    0xc0, 0x9c, 0xe7, 0x5c, 0x04, 0x44, 0x9d, 0xc8, 0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7e, 0xe7,
+    0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7c, 0xe7, 0xdb, 0xb5, 0xe7, 0x7e, 0x7c, 0xc3, 0xbd, 0xdb,
+    0xbd, 0xd9, 0x7e, 0xe7, 0xc7, 0x7e, 0xdb, 0xbd, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x80, 0x50,
+    0x04, 0x00, 0x44, 0xc4, 0x00, 0x40, 0xd0, 0x84, 0x4c, 0x41, 0xbd, 0xd1, 0xd0, 0x00, 0xe5, 0x70,
+    0x00, 0x40, 0x85, 0xd0, 0x50, 0x00, 0xc0, 0x40, 0x10, 0x00, 0x7c, 0xe1, 0xc0, 0x10, 0xd0, 0x30,
+    0xc0, 0x90, 0xe5, 0x5c, 0x50, 0xc4, 0x95, 0xd0, 0xe4, 0x70, 0xdb, 0xb5, 0xb1, 0x50, 0x7c, 0xe5,
+    0x00, 0x00, 0x84, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd8, 0xa5, 0x00, 0x00, 0x4c, 0x41,
+    0x40, 0x44, 0x9d, 0xc8, 0x00, 0x00, 0x44, 0x4c, 0x9d, 0xd0, 0x7e, 0xe7, 0x44, 0x44, 0xdb, 0x9d,
+    0x85, 0xd0, 0x5c, 0xe4, 0x00, 0x44, 0xd8, 0x9d, 0x7c, 0x61, 0xbd, 0xd3, 0xd1, 0x00, 0xe7, 0x7e,
+    0xc5, 0x7c, 0xd9, 0xbd, 0x0c, 0xc9, 0x7e, 0xc5, 0xdb, 0xb5, 0xe7, 0x7e, 0x7e, 0xc7, 0xbd, 0xdb,
+    0x01, 0x00, 0x54, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8, 0xd1, 0x00, 0x00, 0xc0, 0x70,
+    0x45, 0x4c, 0xd1, 0x8c, 0x00, 0xc0, 0x7c, 0xc4, 0xdb, 0x15, 0xe7, 0x7c, 0x70, 0xc0, 0xbd, 0xdb,
+    0xd1, 0x10, 0xc5, 0x7c, 0x70, 0xc0, 0xb0, 0xd0, 0xc0, 0x30, 0xdb, 0xb5, 0xb0, 0x50, 0x70, 0xe0,
+    0x64, 0x64, 0xbd, 0xdb, 0xd9, 0x91, 0xe7, 0x7c, 0x99, 0xd1, 0x7e, 0xe7, 0xe0, 0x72, 0xdb, 0xbd,
+    0x00, 0x00, 0xac, 0xd0, 0x00, 0x00, 0x45, 0x4c, 0x00, 0x00, 0x7c, 0xe7, 0x00, 0x00, 0xdb, 0x1d,
+    0xc0, 0x9c, 0xe7, 0x5c, 0x04, 0x44, 0x9d, 0xc8, 0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7e, 0xe7,
+    0xe7, 0x7c, 0xdb, 0xbd, 0x1d, 0xc1, 0x7c, 0xe7, 0xdb, 0xb5, 0xe7, 0x7e, 0x7c, 0xc3, 0xbd, 0xdb,
+    0xbd, 0xd9, 0x7e, 0xe7, 0xc7, 0x7e, 0xdb, 0xbd, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x80, 0x50,
+    0x04, 0x00, 0x44, 0xc4, 0x00, 0x40, 0xd0, 0x84, 0x4c, 0x41, 0xad, 0xd1, 0xd0, 0x00, 0xe5, 0x70,
+    0x00, 0x40, 0x85, 0xd0, 0x50, 0x00, 0xc0, 0x40, 0x10, 0x00, 0x7c, 0xe1, 0xc0, 0x10, 0xd0, 0x30,
+    0x80, 0x90, 0xe5, 0x5c, 0x50, 0xc4, 0x95, 0xd0, 0x64, 0x60, 0xdb, 0xb5, 0xb1, 0x50, 0x7c, 0xe5,
+    0x00, 0x00, 0x84, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd8, 0xa5, 0x00, 0x00, 0x4c, 0x41,
+    0x40, 0x44, 0x9d, 0xc8, 0x00, 0x00, 0x44, 0x4c, 0x9d, 0xd0, 0x5e, 0xe7, 0x44, 0x44, 0xda, 0x9d,
+    0x85, 0xd0, 0x5c, 0xe4, 0x00, 0x44, 0xd8, 0x9d, 0x7c, 0x61, 0xbd, 0xd3, 0xd1, 0x00, 0xe7, 0x7e,
+    0xc5, 0x7c, 0xd9, 0xbd, 0x0c, 0xc9, 0x7e, 0xc5, 0xdb, 0xb5, 0xe7, 0x7e, 0x7e, 0xc7, 0xbd, 0xdb,
+    0x01, 0x04, 0xc4, 0x54, 0x00, 0x00, 0x84, 0xd0, 0x45, 0x00, 0xd9, 0xbd, 0x00, 0x00, 0x7c, 0xe5,
+    0x5c, 0xc5, 0xbd, 0xd0, 0xc0, 0x14, 0xe5, 0x5c, 0xbd, 0xdb, 0x7c, 0xe7, 0xc5, 0x7c, 0xdb, 0xbd,
+    0xbd, 0xd1, 0x7c, 0xc5, 0xc5, 0x7c, 0xd1, 0xbc, 0x78, 0xe3, 0xbd, 0xdb, 0xdb, 0xb5, 0xe3, 0x74,
+    0xe7, 0x7c, 0xdb, 0xbd, 0xbd, 0xd9, 0x7c, 0xe7, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x20, 0x40, 0xc8, 0xbd, 0x01, 0x00, 0x5c, 0xc5, 0xc0, 0x10, 0xe7, 0x7e, 0x04, 0x00, 0xbd, 0xdb,
+    0xac, 0xd1, 0x7e, 0xe5, 0x45, 0x4c, 0xdb, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e,
+    0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7c, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x00, 0x00, 0x80, 0x50, 0x00, 0x00, 0x44, 0x40, 0x04, 0x00, 0x54, 0xe0, 0x00, 0x00, 0xd8, 0x95,
+    0xc8, 0x95, 0xe5, 0x54, 0x50, 0xc4, 0x95, 0xc8, 0xe5, 0x76, 0xd9, 0xbd, 0xb5, 0xd0, 0x7e, 0xe5,
+    0xe0, 0x44, 0xd9, 0x95, 0x95, 0xd0, 0x54, 0xe0, 0xd1, 0x30, 0xc5, 0x7e, 0x7c, 0x61, 0xbc, 0xd1,
+    0xbd, 0xd1, 0x7e, 0xe5, 0xc5, 0x7c, 0xd9, 0xbd, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x10, 0x00, 0x54, 0xe4, 0x00, 0x00, 0xc8, 0x95, 0x40, 0x00, 0xbd, 0xd9, 0x00, 0x00, 0xe5, 0x7e,
+    0xc5, 0x7c, 0xd1, 0xbc, 0x0c, 0x49, 0x7e, 0xc5, 0xdb, 0xbd, 0xe7, 0x7e, 0x5e, 0xc7, 0xbd, 0xdb,
+    0xd9, 0x9d, 0xe5, 0x7e, 0x5e, 0xc4, 0xbd, 0xd9, 0xe7, 0x76, 0xdb, 0xbd, 0xbd, 0xd3, 0x7e, 0xe7,
+    0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xd8, 0x91,
+    0x88, 0x91, 0xe4, 0x54, 0x50, 0xc4, 0x95, 0xc8, 0x60, 0x62, 0xd9, 0xbd, 0xb1, 0x50, 0x7e, 0xe5,
+    0x60, 0x40, 0xd9, 0x95, 0x91, 0x50, 0x54, 0xe0, 0x80, 0x10, 0xc5, 0x72, 0x50, 0x20, 0xb8, 0xd1,
+    0xb9, 0xd1, 0x7e, 0xe5, 0xc5, 0x7c, 0xd9, 0xbd, 0x70, 0xe2, 0xbd, 0xdb, 0xdb, 0xb5, 0xe7, 0x7e,
+    0x10, 0x00, 0x54, 0xe4, 0x00, 0x00, 0xc8, 0x91, 0x40, 0x00, 0xbd, 0xd9, 0x00, 0x00, 0xe4, 0x76,
+    0xc5, 0x7c, 0xd1, 0xbc, 0x08, 0x49, 0x7e, 0xc5, 0xdb, 0xb5, 0xe7, 0x7e, 0x56, 0xc6, 0xbd, 0xdb,
+    0xd9, 0x95, 0xe5, 0x7e, 0x56, 0xc4, 0xbd, 0xd9, 0xe5, 0x72, 0xdb, 0xbd, 0xb9, 0x51, 0x7e, 0xe7,
+    0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e, 0xbd, 0xdb, 0x7e, 0xe7, 0xe7, 0x7e, 0xdb, 0xbd,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x44, 0x91, 0xc0, 0x40, 0x00, 0xc4, 0x40, 0x91, 0x00, 0x74, 0xe4, 0xc4, 0x50, 0xd8, 0xb5,
+    0x10, 0x00, 0x50, 0xc4, 0x00, 0x40, 0xd0, 0x90, 0x40, 0x00, 0xb5, 0x50, 0x50, 0x00, 0xe0, 0x70,
+    0xc0, 0x44, 0xd9, 0x95, 0x84, 0xd0, 0x74, 0xc4, 0xd1, 0x30, 0xe5, 0x7e, 0x7c, 0xe1, 0xbd, 0xd1,
+    0x00, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x04, 0x44, 0x00, 0x00, 0xe4, 0x70, 0x00, 0x00, 0x99, 0x41,
+    0x04, 0xc0, 0x7c, 0xc4, 0x00, 0x04, 0xc9, 0x0c, 0x7c, 0xc5, 0xbd, 0xdb, 0x49, 0x00, 0xc7, 0x7e,
+    0x70, 0xc4, 0xbd, 0xd9, 0x41, 0x00, 0xc5, 0x4c, 0xb5, 0x50, 0x7e, 0xe7, 0xc4, 0x50, 0xdb, 0xb5,
+    0xd8, 0x8d, 0xe7, 0x7c, 0x4c, 0x44, 0x9d, 0xd9, 0xe7, 0x7e, 0xdb, 0xbd, 0x9d, 0xd3, 0x7e, 0xe7,
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0, 0x54, 0x00, 0x00, 0x80, 0xd0,
+    0x84, 0x50, 0x54, 0xc4, 0x44, 0x40, 0xd0, 0x84, 0x5c, 0xe1, 0xbd, 0xd9, 0xd8, 0x91, 0xe5, 0x7c,
+    0x54, 0xc0, 0x95, 0xd0, 0xd0, 0x00, 0xc0, 0x54, 0xb8, 0xd1, 0x7c, 0xe5, 0xc0, 0x70, 0xd1, 0xb0,
+    0xd9, 0x9d, 0xe5, 0x7c, 0x7c, 0xe4, 0xbd, 0xd8, 0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xdb, 0x7e, 0xe7,
+    0x00, 0x00, 0xc4, 0x40, 0x00, 0x00, 0x84, 0x50, 0x00, 0x00, 0xd8, 0xbd, 0x00, 0x00, 0x5c, 0xe5,
+    0x54, 0xe4, 0xbd, 0xd8, 0xc8, 0x95, 0xe5, 0x4c, 0xbd, 0xd9, 0x7e, 0xe7, 0xe5, 0x7e, 0xdb, 0xbd,
+    0xbd, 0xd0, 0x7c, 0xe5, 0x45, 0x4c, 0xd9, 0x9d, 0x7c, 0xe7, 0xbd, 0xdb, 0xdb, 0x9d, 0xe7, 0x7e,
+    0xe7, 0x7e, 0xdb, 0xbd, 0xbd, 0xd9, 0x7e, 0xe7, 0xdb, 0xbd, 0xe7, 0x7e, 0x7e, 0xe7, 0xbd, 0xdb,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x40, 0x50, 0x80, 0x00, 0x00, 0x40, 0x44, 0xd0, 0x10, 0xe4, 0x54, 0x40, 0x00, 0x95, 0xd0,
+    0x40, 0x00, 0x44, 0x40, 0x40, 0x00, 0x80, 0x50, 0xc0, 0x10, 0xd8, 0x95, 0x80, 0x50, 0x54, 0xe0,
+    0x54, 0xc4, 0x95, 0xd8, 0xd0, 0x94, 0xe4, 0x54, 0xbd, 0xd1, 0x7e, 0xe5, 0xe5, 0x70, 0xd9, 0xb5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x40, 0xc4, 0x00, 0x00, 0xd0, 0x14,
+    0xc0, 0x80, 0xe4, 0x54, 0x04, 0x44, 0x95, 0xc8, 0xe4, 0x70, 0xd9, 0xbd, 0x9d, 0x41, 0x7e, 0xe5,
+    0xc4, 0x40, 0xd8, 0x95, 0x04, 0x00, 0x54, 0xc4, 0xd8, 0xb5, 0xe5, 0x7e, 0x4c, 0x41, 0xbd, 0xd9,
+    0xbd, 0xd9, 0x7e, 0xe5, 0xc5, 0x4c, 0xd9, 0x9d, 0x7e, 0xe7, 0xbd, 0xdb, 0xdb, 0xbd, 0xe7, 0x7e,
+};